@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../vector/flat_map.h"
+#include "common.h"
+
+using std::size_t, std::cout, std::endl;
+
+/// Случайные чётные ключи без повторов: нечётные значения гарантированно отсутствуют в словаре
+static std::vector<std::pair<int64_t, int64_t>> make_pairs(size_t n){
+    std::vector<std::pair<int64_t, int64_t>> pairs(n);
+    for (size_t i = 0; i < n; i++){
+        pairs[i] = {static_cast<int64_t>(2 * i), static_cast<int64_t>(i)};
+    }
+    std::shuffle(pairs.begin(), pairs.end(), std::mt19937_64{42});
+    return pairs;
+}
+
+template <typename Map>
+static Map filled(size_t n){
+    auto pairs = make_pairs(n);
+    Map map;
+    map.insert(pairs.begin(), pairs.end());
+    return map;
+}
+
+/// Поиск ключа на каждой итерации; ключи перебираются в случайном порядке, offset = 1 даёт промахи
+template <typename Map, int64_t offset>
+static void find(State &state){
+    size_t n = state.range(0);
+    Map map = filled<Map>(n);
+    std::vector<int64_t> probes;
+    for (const auto &pair: make_pairs(std::min<size_t>(n, 65536))){
+        probes.push_back(pair.first * static_cast<int64_t>(n / std::min<size_t>(n, 65536)) + offset);
+    }
+    size_t i = 0;
+    for (auto _: state){
+        auto it = map.find(probes[i]);
+        DoNotOptimize(it);
+        i = i + 1 == probes.size() ? 0 : i + 1;
+    }
+}
+
+/// Построение словаря вставкой всего диапазона сразу (для flat_map - одно слияние)
+template <typename Map>
+static void bulk_insert(State &state){
+    auto pairs = make_pairs(state.range(0));
+    for (auto _: state){
+        Map map;
+        map.insert(pairs.begin(), pairs.end());
+        DoNotOptimize(map.size());
+    }
+}
+
+/// Пополнение словаря половины размера второй половиной пар (для flat_map - сортировка хвоста и слияние)
+template <typename Map>
+static void bulk_merge(State &state){
+    auto pairs = make_pairs(state.range(0));
+    auto middle = pairs.begin() + static_cast<std::ptrdiff_t>(pairs.size() / 2);
+    Map source;
+    source.insert(pairs.begin(), middle);
+    for (auto _: state){
+        state.PauseTiming();
+        Map map(source);
+        state.ResumeTiming();
+        map.insert(middle, pairs.end());
+        DoNotOptimize(map.size());
+    }
+}
+
+/// Построение словаря поэлементной вставкой
+template <typename Map>
+static void insert_one_by_one(State &state){
+    auto pairs = make_pairs(state.range(0));
+    for (auto _: state){
+        Map map;
+        for (const auto &pair: pairs){
+            map.insert(pair);
+        }
+        DoNotOptimize(map.size());
+    }
+}
+
+template <typename Map>
+static void add_container(const std::string &container, const std::vector<int64_t> &sizes, bool sorted){
+    bench::add("find_hit/" + container, find<Map, 0>, sizes);
+    bench::add("find_miss/" + container, find<Map, 1>, sizes);
+    bench::add("bulk_insert/" + container, bulk_insert<Map>, sizes);
+    bench::add("bulk_merge/" + container, bulk_merge<Map>, sizes);
+    std::vector<int64_t> small = sizes;
+    if (sorted){
+        // Для flat_map поэлементная вставка квадратична: только небольшие размеры
+        std::erase_if(small, [](int64_t size){ return size > 100000; });
+    }
+    bench::add("insert_one_by_one/" + container, insert_one_by_one<Map>, small);
+}
+
+/// Сводка: время каждого контейнера для пары (операция, размер)
+class Comparison {
+private:
+    static constexpr const char *containers[] = {"MyVec::flat_map", "std::map", "std::unordered_map"};
+    std::map<std::pair<std::string, int64_t>, std::vector<double>> rows;
+    std::vector<std::pair<std::string, int64_t>> order;
+public:
+    /// Добавляет результат по имени вида "операция/контейнер/размер"
+    void add(const std::string &name, double nanoseconds){
+        size_t first = name.find('/');
+        size_t last = name.rfind('/');
+        std::pair<std::string, int64_t> key{name.substr(0, first), std::stoll(name.substr(last + 1))};
+        if (!rows.contains(key)){
+            order.push_back(key);
+            rows[key].assign(std::size(containers), -1);
+        }
+        std::string container = name.substr(first + 1, last - first - 1);
+        for (size_t i = 0; i < std::size(containers); i++){
+            if (container == containers[i]){
+                rows[key][i] = nanoseconds;
+            }
+        }
+    }
+
+    void print(const char *harness) const{
+        cout << "{\n  \"harness\": \"" << harness << "\",\n  \"unit\": \"ns\",\n  \"results\": [";
+        for (size_t i = 0; i < order.size(); i++){
+            const auto &[operation, size] = order[i];
+            cout << (i ? ",\n" : "\n") << "    {\"benchmark\": \"" << operation << "\", \"size\": " << size;
+            const auto &times = rows.at(order[i]);
+            for (size_t j = 0; j < times.size(); j++){
+                cout << ", \"" << containers[j] << "\": " << times[j];
+            }
+            cout << "}";
+        }
+        cout << "\n  ]\n}" << endl;
+    }
+};
+
+/// Запуск: bench_flat_map [--max_size=N] [--filter=подстрока] [--min_time=секунды]
+/// Размеры: 10^2 ... 10^7 не больше max_size (по умолчанию 10^6), ключи и значения - int64_t.
+/// С Google Benchmark --filter и --min_time заменяются её собственными --benchmark_filter и --benchmark_min_time
+int main(int argc, char *argv[]){
+    bench::options options = bench::parse_options(argc, argv, 1000000);
+    std::vector<int64_t> sizes;
+    for (int64_t size = 100; size <= std::min<int64_t>(options.max_size, 10000000); size *= 10){
+        sizes.push_back(size);
+    }
+    add_container<MyVec::flat_map<int64_t, int64_t>>("MyVec::flat_map", sizes, true);
+    add_container<std::map<int64_t, int64_t>>("std::map", sizes, false);
+    add_container<std::unordered_map<int64_t, int64_t>>("std::unordered_map", sizes, false);
+
+    return bench::run_comparison<Comparison>(options);
+}
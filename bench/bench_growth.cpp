@@ -0,0 +1,60 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <sys/resource.h>
+#include "../vector/vector.h"
+#include "../vector/realloc_allocator.h"
+
+using std::uint64_t;
+
+/// Пиковый RSS процесса в мегабайтах
+static double peak_rss_mb(){
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_maxrss) / 1024;
+}
+
+/// Заполняет вектор push_back'ами до target элементов и печатает время каждого удвоения ёмкости
+/// \tparam Vector Тип вектора
+/// \param name Название варианта
+/// \param target Итоговое количество элементов
+template <typename Vector>
+static void grow(const char *name, std::size_t target){
+    using clock = std::chrono::steady_clock;
+    Vector v{};
+    std::size_t capacity = v.capacity();
+    double slowest = 0;
+    auto start = clock::now();
+    auto last = start;
+    for (std::size_t i = 0; i < target; i++){
+        auto before = clock::now();
+        v.push_back(i);
+        if (v.capacity() != capacity){
+            capacity = v.capacity();
+            double push = std::chrono::duration<double, std::milli>(clock::now() - before).count();
+            slowest = std::max(slowest, push);
+            if (capacity >= (std::size_t{1} << 20)){
+                double elapsed = std::chrono::duration<double, std::milli>(clock::now() - last).count();
+                cout << name << ": capacity " << capacity << " (" << capacity * sizeof(uint64_t) / (1 << 20)
+                     << " MB), growth push " << push << " ms, since previous growth " << elapsed << " ms" << endl;
+            }
+            last = clock::now();
+        }
+    }
+    double total = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    cout << name << ": total " << total << " ms, slowest growth " << slowest << " ms, peak RSS "
+         << peak_rss_mb() << " MB" << endl;
+}
+
+/// Запуск: bench_growth [количество элементов] [malloc|realloc]
+/// Пиковый RSS считается на процесс, поэтому варианты лучше запускать по отдельности
+int main(int argc, char *argv[]){
+    std::size_t target = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{1} << 28;
+    std::string mode = argc > 2 ? argv[2] : "realloc";
+    if (mode == "malloc"){
+        grow<MyVec::vector<uint64_t>>("std::allocator", target);
+    } else {
+        grow<MyVec::vector<uint64_t, MyVec::realloc_allocator<uint64_t>>>("realloc_allocator", target);
+    }
+    return 0;
+}
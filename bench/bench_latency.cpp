@@ -0,0 +1,50 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../vector/vector.h"
+#include "../vector/incremental_vector.h"
+
+using std::uint64_t;
+
+/// Заполняет вектор push_back'ами до target элементов, замеряя каждое добавление, и печатает перцентили задержки
+/// \tparam Vector Тип вектора
+/// \param name Название варианта
+/// \param target Итоговое количество элементов
+template <typename Vector>
+static void latency(const char *name, std::size_t target){
+    using clock = std::chrono::steady_clock;
+    std::vector<std::uint32_t> samples(target);
+    Vector v{};
+    for (std::size_t i = 0; i < target; i++){
+        auto before = clock::now();
+        v.push_back(i);
+        auto after = clock::now();
+        samples[i] = static_cast<std::uint32_t>(std::min<std::int64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count(), UINT32_MAX));
+    }
+    std::uint32_t slowest = *std::max_element(samples.begin(), samples.end());
+    auto percentile = [&samples](double p){
+        auto nth = samples.begin() + static_cast<std::ptrdiff_t>(p * static_cast<double>(samples.size() - 1));
+        std::nth_element(samples.begin(), nth, samples.end());
+        return *nth;
+    };
+    std::cout << name << ": p50 " << percentile(0.5) << " ns, p99 " << percentile(0.99) << " ns, p99.9 "
+              << percentile(0.999) << " ns, max " << slowest / 1e6 << " ms" << std::endl;
+}
+
+/// Запуск: bench_latency [количество элементов] [vector|incremental|all]
+int main(int argc, char *argv[]){
+    std::size_t target = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{50'000'000};
+    std::string mode = argc > 2 ? argv[2] : "all";
+    if (mode != "incremental"){
+        latency<MyVec::vector<uint64_t>>("vector", target);
+    }
+    if (mode != "vector"){
+        latency<MyVec::incremental_vector<uint64_t>>("incremental_vector", target);
+    }
+    return 0;
+}
@@ -0,0 +1,268 @@
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "../vector/vector.h"
+#include "../tests/buffer.h"
+#include "common.h"
+
+using std::size_t;
+
+/// Значение i-го элемента для каждого из типов
+template <typename T>
+static T make(size_t i);
+
+template <>
+int make<int>(size_t i){ return static_cast<int>(i); }
+
+template <>
+std::string make<std::string>(size_t i){ return std::to_string(i); }
+
+template <>
+std::shared_ptr<std::string> make<std::shared_ptr<std::string>>(size_t i){
+    return std::make_shared<std::string>(std::to_string(i));
+}
+
+template <>
+Buffer make<Buffer>(size_t i){ return Buffer(static_cast<int>(i % 2 + 1)); }
+
+/// Величина, которую обход вектора накапливает по элементу
+static size_t weight(int value){ return static_cast<size_t>(value); }
+static size_t weight(const std::string &value){ return value.size(); }
+static size_t weight(const std::shared_ptr<std::string> &value){ return value->size(); }
+static size_t weight(const Buffer &value){ return static_cast<size_t>(value.length()); }
+
+/// Нечётность индекса i, из которого элемент построен make<T>(i)
+static bool odd(int value){ return value & 1; }
+static bool odd(const std::string &value){ return (value.back() - '0') & 1; }
+static bool odd(const std::shared_ptr<std::string> &value){ return odd(*value); }
+static bool odd(const Buffer &value){ return value.length() == 2; }
+
+template <typename Vector>
+static Vector filled(size_t n){
+    Vector v;
+    v.reserve(n);
+    for (size_t i = 0; i < n; i++){
+        v.push_back(make<typename Vector::value_type>(i));
+    }
+    return v;
+}
+
+template <typename Vector, bool Reserve>
+static void push_back(State &state){
+    using T = typename Vector::value_type;
+    size_t n = state.range(0);
+    T value = make<T>(n);
+    for (auto _: state){
+        Vector v;
+        if constexpr (Reserve){
+            v.reserve(n);
+        }
+        for (size_t i = 0; i < n; i++){
+            v.push_back(value);
+        }
+        DoNotOptimize(v.data());
+    }
+}
+
+template <typename Vector, bool Reserve>
+static void emplace_back(State &state){
+    size_t n = state.range(0);
+    for (auto _: state){
+        Vector v;
+        if constexpr (Reserve){
+            v.reserve(n);
+        }
+        for (size_t i = 0; i < n; i++){
+            v.emplace_back(make<typename Vector::value_type>(i));
+        }
+        DoNotOptimize(v.data());
+    }
+}
+
+template <typename Vector>
+static void copy_construct(State &state){
+    Vector source = filled<Vector>(state.range(0));
+    for (auto _: state){
+        Vector copy(source);
+        DoNotOptimize(copy.data());
+    }
+}
+
+/// Перемещение туда и обратно, чтобы не восстанавливать источник на паузе
+template <typename Vector>
+static void move_construct(State &state){
+    Vector source = filled<Vector>(state.range(0));
+    for (auto _: state){
+        Vector moved(std::move(source));
+        DoNotOptimize(moved.data());
+        source = std::move(moved);
+        ClobberMemory();
+    }
+}
+
+/// Удаление из копии source: копия создаётся на паузе, измеряется только erase
+template <typename Vector, typename Erase>
+static void erase_from_copy(State &state, Erase erase){
+    Vector source = filled<Vector>(state.range(0));
+    for (auto _: state){
+        state.PauseTiming();
+        Vector v(source);
+        state.ResumeTiming();
+        erase(v);
+        DoNotOptimize(v.data());
+    }
+}
+
+template <typename Vector>
+static void erase_front(State &state){
+    erase_from_copy<Vector>(state, [](Vector &v){ v.erase(v.begin()); });
+}
+
+template <typename Vector>
+static void erase_back(State &state){
+    erase_from_copy<Vector>(state, [](Vector &v){ v.erase(v.end() - 1); });
+}
+
+template <typename Vector>
+static void erase_middle(State &state){
+    erase_from_copy<Vector>(state, [](Vector &v){ v.erase(v.begin() + v.size() / 2); });
+}
+
+template <typename Vector>
+static void erase_range(State &state){
+    erase_from_copy<Vector>(state, [](Vector &v){ v.erase(v.begin() + v.size() / 4, v.begin() + v.size() * 3 / 4); });
+}
+
+/// Удаление элементов с нечётными индексами (ровно половины) одним проходом
+/// (erase_if находится по ADL для обоих контейнеров)
+template <typename Vector>
+static void erase_if_half(State &state){
+    erase_from_copy<Vector>(state, [](Vector &v){ erase_if(v, [](const auto &e){ return odd(e); }); });
+}
+
+/// Построение отсортированного вектора вставками в позицию lower_bound
+template <typename Vector>
+static void sorted_insert(State &state){
+    using T = typename Vector::value_type;
+    size_t n = state.range(0);
+    for (auto _: state){
+        Vector v;
+        for (size_t i = 0; i < n; i++){
+            T value = make<T>(i * 7919 % n);
+            v.insert(std::lower_bound(v.begin(), v.end(), value), std::move(value));
+        }
+        DoNotOptimize(v.data());
+    }
+}
+
+template <typename Vector>
+static void iterate(State &state){
+    Vector v = filled<Vector>(state.range(0));
+    for (auto _: state){
+        size_t sum = 0;
+        for (const auto &element: v){
+            sum += weight(element);
+        }
+        DoNotOptimize(sum);
+    }
+}
+
+/// Поиск последнего элемента - худший случай линейного поиска
+template <typename Vector>
+static void find(State &state){
+    Vector v = filled<Vector>(state.range(0));
+    auto value = v.back();
+    for (auto _: state){
+        auto it = std::find(v.begin(), v.end(), value);
+        DoNotOptimize(it);
+    }
+}
+
+template <typename Vector>
+static void add_container(const std::string &suffix, const std::vector<int64_t> &sizes){
+    bench::add("push_back/" + suffix, push_back<Vector, false>, sizes);
+    bench::add("push_back_reserved/" + suffix, push_back<Vector, true>, sizes);
+    bench::add("emplace_back/" + suffix, emplace_back<Vector, false>, sizes);
+    bench::add("emplace_back_reserved/" + suffix, emplace_back<Vector, true>, sizes);
+    bench::add("copy_construct/" + suffix, copy_construct<Vector>, sizes);
+    bench::add("move_construct/" + suffix, move_construct<Vector>, sizes);
+    bench::add("erase_front/" + suffix, erase_front<Vector>, sizes);
+    bench::add("erase_back/" + suffix, erase_back<Vector>, sizes);
+    bench::add("erase_middle/" + suffix, erase_middle<Vector>, sizes);
+    bench::add("erase_range/" + suffix, erase_range<Vector>, sizes);
+    bench::add("erase_if/" + suffix, erase_if_half<Vector>, sizes);
+    if constexpr (std::totally_ordered<typename Vector::value_type>){
+        // Квадратичная операция: только небольшие размеры
+        std::vector<int64_t> small;
+        std::copy_if(sizes.begin(), sizes.end(), std::back_inserter(small), [](int64_t size){ return size <= 16384; });
+        bench::add("sorted_insert/" + suffix, sorted_insert<Vector>, small);
+    }
+    bench::add("iterate/" + suffix, iterate<Vector>, sizes);
+    bench::add("find/" + suffix, find<Vector>, sizes);
+}
+
+template <typename T>
+static void add_type(const std::string &type, const std::vector<int64_t> &sizes){
+    add_container<MyVec::vector<T>>(type + "/MyVec::vector", sizes);
+    add_container<std::vector<T>>(type + "/std::vector", sizes);
+}
+
+/// Сводка: время MyVec::vector и std::vector для каждой пары (операция, тип, размер)
+class Comparison {
+private:
+    std::map<std::tuple<std::string, std::string, int64_t>, std::pair<double, double>> rows;
+    std::vector<std::tuple<std::string, std::string, int64_t>> order;
+public:
+    /// Добавляет результат по имени вида "операция/тип/контейнер/размер"
+    void add(const std::string &name, double nanoseconds){
+        size_t first = name.find('/');
+        size_t last = name.rfind('/');
+        size_t container = name.rfind('/', last - 1);
+        std::tuple key{name.substr(0, first), name.substr(first + 1, container - first - 1),
+                       std::stoll(name.substr(last + 1))};
+        if (!rows.contains(key)){
+            order.push_back(key);
+            rows[key] = {-1, -1};
+        }
+        auto &row = rows[key];
+        (name.compare(container + 1, last - container - 1, "std::vector") == 0 ? row.second : row.first) = nanoseconds;
+    }
+
+    void print(const char *harness) const{
+        cout << "{\n  \"harness\": \"" << harness << "\",\n  \"unit\": \"ns\",\n  \"results\": [";
+        for (size_t i = 0; i < order.size(); i++){
+            const auto &[operation, type, size] = order[i];
+            const auto &[mine, standard] = rows.at(order[i]);
+            cout << (i ? ",\n" : "\n") << "    {\"benchmark\": \"" << operation << "\", \"type\": \"" << type
+                 << "\", \"size\": " << size << ", \"MyVec::vector\": " << mine << ", \"std::vector\": " << standard;
+            if (mine > 0 && standard > 0){
+                cout << ", \"ratio\": " << mine / standard;
+            }
+            cout << "}";
+        }
+        cout << "\n  ]\n}" << endl;
+    }
+};
+
+/// Запуск: bench_vector [--max_size=N] [--filter=подстрока] [--min_time=секунды]
+/// Размеры: 8, 64, 1024, 16384, 10^5, 10^6, 10^7, 10^8 не больше max_size (по умолчанию 10^6).
+/// С Google Benchmark --filter и --min_time заменяются её собственными --benchmark_filter и --benchmark_min_time
+int main(int argc, char *argv[]){
+    bench::options options = bench::parse_options(argc, argv, 1000000);
+    std::vector<int64_t> sizes;
+    for (int64_t size: {8, 64, 1024, 16384, 100000, 1000000, 10000000, 100000000}){
+        if (size <= options.max_size){
+            sizes.push_back(size);
+        }
+    }
+    add_type<int>("int", sizes);
+    add_type<std::string>("string", sizes);
+    add_type<std::shared_ptr<std::string>>("shared_ptr<string>", sizes);
+    add_type<Buffer>("Buffer", sizes);
+
+    return bench::run_comparison<Comparison>(options);
+}
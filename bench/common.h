@@ -0,0 +1,117 @@
+#ifndef MYVEC_BENCH_COMMON_H
+#define MYVEC_BENCH_COMMON_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifdef MYVEC_HAVE_GOOGLE_BENCHMARK
+#include <benchmark/benchmark.h>
+using benchmark::State, benchmark::DoNotOptimize, benchmark::ClobberMemory;
+#else
+#include "harness.h"
+using bench::State, bench::DoNotOptimize, bench::ClobberMemory;
+#endif
+
+/// Общая обвязка сравнительных бенчмарков: регистрация по размерам, разбор аргументов и запуск
+/// через Google Benchmark или harness.h со сводкой в JSON
+namespace bench {
+    /// Аргументы командной строки: [--max_size=N] [--filter=подстрока] [--min_time=секунды].
+    /// С Google Benchmark --filter и --min_time заменяются её собственными --benchmark_filter и --benchmark_min_time
+    struct options {
+        std::int64_t max_size = 0;
+        std::string filter;
+        double min_time = 0.2;
+        /// Остальные аргументы (вместе с именем программы) для Google Benchmark
+        std::vector<char *> rest;
+    };
+
+    /// Разбирает аргументы командной строки
+    /// \param argc Количество аргументов
+    /// \param argv Аргументы
+    /// \param maxSize Максимальный размер по умолчанию
+    /// \return Разобранные аргументы
+    inline options parse_options(int argc, char *argv[], std::int64_t maxSize){
+        options result;
+        result.max_size = maxSize;
+        result.rest.push_back(argv[0]);
+        for (int i = 1; i < argc; i++){
+            std::string argument = argv[i];
+            if (argument.starts_with("--max_size=")){
+                result.max_size = std::strtoll(argument.c_str() + 11, nullptr, 10);
+            } else if (argument.starts_with("--filter=")){
+                result.filter = argument.substr(9);
+            } else if (argument.starts_with("--min_time=")){
+                result.min_time = std::strtod(argument.c_str() + 11, nullptr);
+            } else {
+                result.rest.push_back(argv[i]);
+            }
+        }
+        return result;
+    }
+
+    /// Регистрирует бенчмарк под именем name для каждого размера
+    /// \param name Имя бенчмарка
+    /// \param function Тело бенчмарка
+    /// \param sizes Размеры, передаваемые через State::range()
+    template <typename Function>
+    void add(const std::string &name, Function function, const std::vector<std::int64_t> &sizes){
+        for (std::int64_t size: sizes){
+#ifdef MYVEC_HAVE_GOOGLE_BENCHMARK
+            benchmark::RegisterBenchmark(name.c_str(), function)->Arg(size)->Unit(benchmark::kNanosecond);
+#else
+            register_benchmark(name, size, function);
+#endif
+        }
+    }
+
+#ifdef MYVEC_HAVE_GOOGLE_BENCHMARK
+    /// Вместо консольного вывода собирает результаты и печатает сводку в JSON
+    /// \tparam Comparison Сводка с add(имя, наносекунды) и print(имя harness)
+    template <typename Comparison>
+    class ComparisonReporter : public benchmark::BenchmarkReporter {
+    private:
+        Comparison comparison;
+    public:
+        bool ReportContext(const Context &) override{ return true; }
+
+        void ReportRuns(const std::vector<Run> &runs) override{
+            for (const Run &run: runs){
+                if (run.run_type == Run::RT_Iteration && !run.error_occurred){
+                    comparison.add(run.benchmark_name(), run.GetAdjustedRealTime());
+                }
+            }
+        }
+
+        void Finalize() override{ comparison.print("google-benchmark"); }
+    };
+#endif
+
+    /// Запускает зарегистрированные бенчмарки и печатает сводку
+    /// \tparam Comparison Сводка с add(имя, наносекунды) и print(имя harness)
+    /// \param options Аргументы командной строки
+    /// \return Код возврата программы
+    template <typename Comparison>
+    int run_comparison(options &options){
+#ifdef MYVEC_HAVE_GOOGLE_BENCHMARK
+        int count = static_cast<int>(options.rest.size());
+        benchmark::Initialize(&count, options.rest.data());
+        if (benchmark::ReportUnrecognizedArguments(count, options.rest.data())){
+            return 1;
+        }
+        ComparisonReporter<Comparison> reporter;
+        benchmark::RunSpecifiedBenchmarks(&reporter);
+        benchmark::Shutdown();
+#else
+        Comparison comparison;
+        for (const Result &result: run(options.filter, options.min_time)){
+            comparison.add(result.name, result.nanoseconds);
+        }
+        comparison.print("fallback");
+#endif
+        return 0;
+    }
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef MYVEC_BENCH_HARNESS_H
+#define MYVEC_BENCH_HARNESS_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Минимальная замена Google Benchmark для сборок без неё: тот же интерфейс State
+/// (for (auto _ : state), range(), PauseTiming()/ResumeTiming()) и DoNotOptimize/ClobberMemory
+namespace bench {
+    using clock = std::chrono::steady_clock;
+
+    /// Состояние одного запуска бенчмарка: заданное число итераций и накопленное время без пауз
+    class State {
+    private:
+        std::int64_t argument;
+        std::uint64_t iterations;
+        clock::time_point start{};
+        clock::duration elapsed{};
+    public:
+        /// Значение переменной цикла; как и в Google Benchmark, не несёт данных
+        struct [[maybe_unused]] Value {};
+
+        class iterator {
+        private:
+            State *state;
+            std::uint64_t left;
+        public:
+            iterator(State *state, std::uint64_t left) : state{state}, left{left}{}
+            Value operator*() const{ return {}; }
+            iterator &operator++(){
+                --left;
+                return *this;
+            }
+            bool operator!=(const iterator &) const{
+                if (left == 0){
+                    state->PauseTiming();
+                    return false;
+                }
+                return true;
+            }
+        };
+
+        State(std::int64_t argument, std::uint64_t iterations) : argument{argument}, iterations{iterations}{}
+
+        iterator begin(){
+            ResumeTiming();
+            return {this, iterations};
+        }
+        iterator end(){ return {this, 0}; }
+
+        /// Аргумент бенчмарка (размер контейнера)
+        std::int64_t range(std::size_t = 0) const{ return argument; }
+        void PauseTiming(){ elapsed += clock::now() - start; }
+        void ResumeTiming(){ start = clock::now(); }
+
+        /// Время итераций без пауз в наносекундах
+        double elapsed_ns() const{ return std::chrono::duration<double, std::nano>(elapsed).count(); }
+    };
+
+    template <typename T>
+    inline void DoNotOptimize(T const &value){
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    inline void ClobberMemory(){
+        asm volatile("" : : : "memory");
+    }
+
+    /// Зарегистрированный бенчмарк
+    struct Benchmark {
+        std::string name;
+        std::int64_t argument;
+        std::function<void(State &)> function;
+    };
+
+    /// Результат бенчмарка: полное имя (с аргументом через '/') и время одной итерации
+    struct Result {
+        std::string name;
+        double nanoseconds;
+    };
+
+    inline std::vector<Benchmark> &registry(){
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    /// Регистрирует бенчмарк с одним аргументом
+    /// \param name Имя бенчмарка
+    /// \param argument Аргумент, доступный через State::range()
+    /// \param function Тело бенчмарка
+    inline void register_benchmark(std::string name, std::int64_t argument, std::function<void(State &)> function){
+        registry().push_back({std::move(name), argument, std::move(function)});
+    }
+
+    /// Запускает бенчмарки, имя которых содержит filter. Число итераций растёт в 10 раз,
+    /// пока время запуска не превысит minTime секунд
+    /// \param filter Подстрока имени
+    /// \param minTime Минимальное время запуска в секундах
+    /// \return Результаты в порядке регистрации
+    inline std::vector<Result> run(const std::string &filter, double minTime){
+        std::vector<Result> results;
+        for (Benchmark &benchmark: registry()){
+            std::string name = benchmark.name + "/" + std::to_string(benchmark.argument);
+            if (name.find(filter) == std::string::npos){
+                continue;
+            }
+            for (std::uint64_t iterations = 1;; iterations *= 10){
+                State state(benchmark.argument, iterations);
+                benchmark.function(state);
+                if (state.elapsed_ns() >= minTime * 1e9 || iterations >= (std::uint64_t{1} << 40)){
+                    results.push_back({name, state.elapsed_ns() / static_cast<double>(iterations)});
+                    break;
+                }
+            }
+        }
+        return results;
+    }
+}
+
+#endif
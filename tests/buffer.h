@@ -37,6 +37,12 @@ public:
         return *this;
     }
 
+    int length() const noexcept{ return size; }
+
+    string &operator[](int index){ return buffer[index]; }
+
+    const string &operator[](int index) const{ return buffer[index]; }
+
     bool operator==(const Buffer &second) const{
         if (size != second.size){
             return false;
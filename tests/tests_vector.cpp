@@ -1,12 +1,62 @@
 #define CATCH_CONFIG_MAIN
 
 #include <catch2/catch.hpp>
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <numeric>
+#include <sstream>
 #include "../vector/vector.h"
+#include "../vector/realloc_allocator.h"
+#include "../vector/small_vector.h"
+#include "../vector/simd.h"
+#include "../vector/telemetry.h"
+#include "../vector/mmap_vector.h"
+#include "../vector/io.h"
+#include "../vector/aligned_allocator.h"
+#include "../vector/soa_vector.h"
+#include "../vector/concurrent_vector.h"
+#include "../vector/incremental_vector.h"
+#include "../vector/cow_vector.h"
+#include "../vector/persistent_vector.h"
+#include "../vector/inplace_vector.h"
+#include "../vector/flat_map.h"
 #include "buffer.h"
 
 using std::string, std::shared_ptr, std::make_shared;
 using MyVec::vector, MyVec::VectorIterator;
 
+template <>
+struct MyVec::is_trivially_relocatable<Buffer> : std::true_type {};
+
+/// memory_resource, считающий выделения и освобождения памяти
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+    std::size_t bytes = 0;
+private:
+    std::pmr::memory_resource *upstream = std::pmr::new_delete_resource();
+
+    void *do_allocate(std::size_t size, std::size_t alignment) override{
+        allocations++;
+        bytes += size;
+        return upstream->allocate(size, alignment);
+    }
+
+    void do_deallocate(void *p, std::size_t size, std::size_t alignment) override{
+        deallocations++;
+        bytes -= size;
+        upstream->deallocate(p, size, alignment);
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override{
+        return this == &other;
+    }
+};
+
 TEST_CASE("Simple value (string)"){
     SECTION("Constructors"){
         SECTION("Default"){
@@ -632,4 +682,2280 @@ TEST_CASE("Complex value (shared_ptr<string>)"){
             REQUIRE(*v3[1] == "5");
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Allocator (pmr, Buffer)"){
+    SECTION("Constructors"){
+        SECTION("Default"){
+            CountingResource res;
+            {
+                MyVec::pmr::vector<Buffer> v{&res};
+                REQUIRE(v.empty());
+                REQUIRE(v.get_allocator().resource() == &res);
+            }
+            REQUIRE(res.allocations == 0);
+        }SECTION("By size and value"){
+            CountingResource res;
+            {
+                MyVec::pmr::vector<Buffer> v(10, Buffer{5}, &res);
+                REQUIRE(v.size() == 10);
+                REQUIRE(v[9] == Buffer{5});
+                REQUIRE(res.allocations == 1);
+                REQUIRE(res.bytes == 10 * sizeof(Buffer));
+            }
+            REQUIRE(res.deallocations == 1);
+            REQUIRE(res.bytes == 0);
+        }SECTION("By init list"){
+            CountingResource res;
+            MyVec::pmr::vector<Buffer> v({Buffer{1}, Buffer{5}, Buffer{10}}, &res);
+            REQUIRE(v.size() == 3);
+            REQUIRE(res.allocations == 1);
+        }SECTION("Copy"){
+            CountingResource res;
+            MyVec::pmr::vector<Buffer> v({Buffer{1}, Buffer{5}}, &res);
+            MyVec::pmr::vector<Buffer> v2{v};
+            REQUIRE(v2.size() == 2);
+            REQUIRE(v2[1] == Buffer{5});
+            REQUIRE(v2.get_allocator().resource() == std::pmr::get_default_resource());
+            REQUIRE(res.allocations == 1);
+            CountingResource res2;
+            MyVec::pmr::vector<Buffer> v3{v, &res2};
+            REQUIRE(v3[0] == Buffer{1});
+            REQUIRE(res2.allocations == 1);
+        }SECTION("Move"){
+            CountingResource res;
+            MyVec::pmr::vector<Buffer> v({Buffer{1}, Buffer{5}}, &res);
+            MyVec::pmr::vector<Buffer> v2{std::move(v)};
+            REQUIRE(v2.size() == 2);
+            REQUIRE(v2.get_allocator().resource() == &res);
+            REQUIRE(res.allocations == 1);
+            CountingResource res2;
+            MyVec::pmr::vector<Buffer> v3{std::move(v2), &res2};
+            REQUIRE(v3.size() == 2);
+            REQUIRE(v3[1] == Buffer{5});
+            REQUIRE(res2.allocations == 1);
+        }
+    }
+
+    SECTION("Operators"){
+        SECTION("= - Copy"){
+            CountingResource res, res2;
+            MyVec::pmr::vector<Buffer> v({Buffer{1}, Buffer{5}}, &res);
+            MyVec::pmr::vector<Buffer> v2{&res2};
+            v2 = v;
+            REQUIRE(v2.size() == 2);
+            REQUIRE(v2.get_allocator().resource() == &res2);
+            REQUIRE(res2.allocations == 1);
+        }SECTION("= - Move, different resources"){
+            CountingResource res, res2;
+            MyVec::pmr::vector<Buffer> v({Buffer{1}, Buffer{5}}, &res);
+            MyVec::pmr::vector<Buffer> v2{&res2};
+            v2 = std::move(v);
+            REQUIRE(v2.size() == 2);
+            REQUIRE(v2[0] == Buffer{1});
+            REQUIRE(v2.get_allocator().resource() == &res2);
+            REQUIRE(res2.allocations == 1);
+        }SECTION("= - Move, same resource"){
+            CountingResource res;
+            MyVec::pmr::vector<Buffer> v({Buffer{1}, Buffer{5}}, &res);
+            MyVec::pmr::vector<Buffer> v2{&res};
+            v2 = std::move(v);
+            REQUIRE(v2.size() == 2);
+            REQUIRE(res.allocations == 1);
+        }
+    }
+
+    SECTION("Methods"){
+        SECTION("Push back"){
+            CountingResource res;
+            {
+                MyVec::pmr::vector<Buffer> v{&res};
+                for (int i = 0; i < 5; i++){
+                    v.push_back(Buffer{i});
+                }
+                v.emplace_back(5);
+                REQUIRE(v.size() == 6);
+                REQUIRE(v[5] == Buffer{5});
+                REQUIRE(res.allocations == 4);
+                REQUIRE(res.deallocations == 3);
+                REQUIRE(res.bytes == v.capacity() * sizeof(Buffer));
+            }
+            REQUIRE(res.bytes == 0);
+        }SECTION("Monotonic arena"){
+            std::array<std::byte, 4096> storage{};
+            std::pmr::monotonic_buffer_resource arena{storage.data(), storage.size(),
+                                                      std::pmr::null_memory_resource()};
+            MyVec::pmr::vector<Buffer> v{&arena};
+            v.reserve(16);
+            for (int i = 0; i < 16; i++){
+                v.emplace_back(i);
+            }
+            REQUIRE(v.size() == 16);
+            REQUIRE(v.back() == Buffer{15});
+        }SECTION("Swap"){
+            CountingResource res;
+            MyVec::pmr::vector<Buffer> v({Buffer{1}}, &res);
+            MyVec::pmr::vector<Buffer> v2({Buffer{2}, Buffer{3}}, &res);
+            v.swap(v2);
+            REQUIRE(v.size() == 2);
+            REQUIRE(v2[0] == Buffer{1});
+        }
+    }
+}
+
+TEST_CASE("Trivially relocatable types"){
+    static_assert(MyVec::is_trivially_relocatable_v<int>);
+    static_assert(MyVec::is_trivially_relocatable_v<shared_ptr<string>>);
+    static_assert(MyVec::is_trivially_relocatable_v<Buffer>);
+    static_assert(MyVec::is_trivially_relocatable_v<vector<string>>);
+
+    SECTION("Growth keeps ownership (shared_ptr<string>)"){
+        shared_ptr<string> p = make_shared<string>("1");
+        vector<shared_ptr<string>> v{};
+        for (int i = 0; i < 100; i++){
+            v.push_back(p);
+        }
+        REQUIRE(p.use_count() == 101);
+        v.reserve(1000);
+        REQUIRE(p.use_count() == 101);
+        v.clear();
+        REQUIRE(p.use_count() == 1);
+    }SECTION("Push back of own element"){
+        vector<Buffer> v{Buffer{3}};
+        for (int i = 0; i < 10; i++){
+            v.push_back(v[0]);
+        }
+        REQUIRE(v.size() == 11);
+        REQUIRE(v[10] == Buffer{3});
+    }SECTION("Erase (shared_ptr<string>)"){
+        shared_ptr<string> p = make_shared<string>("1");
+        vector<shared_ptr<string>> v{5, p};
+        v.erase(v.begin() + 1);
+        REQUIRE(p.use_count() == 5);
+        v.erase(v.begin(), v.begin() + 2);
+        REQUIRE(p.use_count() == 3);
+        REQUIRE(v.size() == 2);
+    }SECTION("Erase (int)"){
+        vector<int> v{1, 2, 3, 4, 5};
+        v.erase(v.begin() + 1);
+        REQUIRE(v[1] == 3);
+        v.erase(v.begin(), v.begin() + 2);
+        REQUIRE(v.size() == 2);
+        REQUIRE(v[0] == 4);
+        REQUIRE(v[1] == 5);
+    }
+}
+
+TEST_CASE("Realloc allocator"){
+    SECTION("Growth through realloc and mremap (uint64_t)"){
+        using alloc = MyVec::realloc_allocator<std::uint64_t>;
+        vector<std::uint64_t, alloc> v{};
+        const std::size_t n = 2 * alloc::mmap_threshold / sizeof(std::uint64_t);
+        for (std::size_t i = 0; i < n; i++){
+            v.push_back(i);
+        }
+        REQUIRE(v.size() == n);
+        REQUIRE(v.capacity() >= n);
+        bool intact = true;
+        for (std::size_t i = 0; i < n; i++){
+            intact = intact && v[i] == i;
+        }
+        REQUIRE(intact);
+        v.reserve(4 * n);
+        REQUIRE(v[n - 1] == n - 1);
+        v.erase(v.begin(), v.begin() + 10);
+        REQUIRE(v[0] == 10);
+    }SECTION("Push back of own element (Buffer)"){
+        vector<Buffer, MyVec::realloc_allocator<Buffer>> v{};
+        v.emplace_back(3);
+        for (int i = 0; i < 20; i++){
+            v.push_back(v[0]);
+        }
+        REQUIRE(v.size() == 21);
+        REQUIRE(v[20] == Buffer{3});
+        vector<Buffer, MyVec::realloc_allocator<Buffer>> v2{v};
+        REQUIRE(v2[5] == Buffer{3});
+    }
+}
+
+/// Проверяет, доступен ли вызов first.swap(second)
+template <typename First, typename Second>
+concept member_swappable = requires (First &first, Second &second){ first.swap(second); };
+
+TEST_CASE("Small vector (Buffer)"){
+    using MyVec::small_vector;
+    SECTION("Constructors"){
+        SECTION("Default"){
+            small_vector<Buffer, 4> v{};
+            REQUIRE(v.empty());
+            REQUIRE(v.capacity() == 4);
+            REQUIRE(v.is_inline());
+        }SECTION("By size and value"){
+            small_vector<Buffer, 4> v(3, Buffer{5});
+            REQUIRE(v.size() == 3);
+            REQUIRE(v.is_inline());
+            small_vector<Buffer, 4> v2(10, Buffer{5});
+            REQUIRE(v2.size() == 10);
+            REQUIRE(!v2.is_inline());
+            REQUIRE(v2[9] == Buffer{5});
+        }SECTION("By init list"){
+            small_vector<Buffer, 4> v{Buffer{1}, Buffer{5}, Buffer{10}, Buffer{20}};
+            REQUIRE(v.size() == 4);
+            REQUIRE(v.is_inline());
+        }SECTION("Copy"){
+            small_vector<Buffer, 4> v{Buffer{1}, Buffer{5}, Buffer{10}, Buffer{20}, Buffer{30}};
+            small_vector<Buffer, 4> v2{v};
+            REQUIRE(v2.size() == v.size());
+            REQUIRE(v2[4] == v[4]);
+            REQUIRE(v2.data() != v.data());
+        }SECTION("Move - inline"){
+            small_vector<Buffer, 4> v{Buffer{1}, Buffer{5}};
+            small_vector<Buffer, 4> v2{std::move(v)};
+            REQUIRE(v2.size() == 2);
+            REQUIRE(v2.is_inline());
+            REQUIRE(v2[1] == Buffer{5});
+            REQUIRE(v.empty());
+        }SECTION("Move - heap"){
+            small_vector<Buffer, 2> v{Buffer{1}, Buffer{5}, Buffer{10}};
+            const Buffer *data = v.data();
+            small_vector<Buffer, 2> v2{std::move(v)};
+            REQUIRE(v2.data() == data);
+            REQUIRE(v2.size() == 3);
+            REQUIRE(v.empty());
+            REQUIRE(v.is_inline());
+            v.push_back(Buffer{1});
+            REQUIRE(v[0] == Buffer{1});
+        }
+    }
+
+    SECTION("Operators"){
+        SECTION("= - Copy"){
+            small_vector<Buffer, 2> v{Buffer{1}, Buffer{5}, Buffer{10}};
+            small_vector<Buffer, 2> v2{Buffer{2}};
+            v2 = v;
+            REQUIRE(v2.size() == 3);
+            REQUIRE(v2[2] == Buffer{10});
+        }SECTION("= - Move"){
+            small_vector<Buffer, 2> v{Buffer{1}, Buffer{5}, Buffer{10}};
+            small_vector<Buffer, 2> v2{Buffer{2}, Buffer{3}, Buffer{4}};
+            v2 = std::move(v);
+            REQUIRE(v2.size() == 3);
+            REQUIRE(v2[0] == Buffer{1});
+            small_vector<Buffer, 2> v3{Buffer{7}};
+            v2 = std::move(v3);
+            REQUIRE(v2.size() == 1);
+            REQUIRE(v2.is_inline());
+            REQUIRE(v2[0] == Buffer{7});
+        }SECTION("= - Init list"){
+            small_vector<Buffer, 2> v{};
+            v = {Buffer{1}, Buffer{5}, Buffer{10}};
+            REQUIRE(v.size() == 3);
+            v = {Buffer{1}};
+            REQUIRE(v.size() == 1);
+        }
+    }
+
+    SECTION("Methods"){
+        SECTION("Push back spills to heap"){
+            small_vector<Buffer, 4> v{};
+            for (int i = 0; i < 4; i++){
+                v.push_back(Buffer{i});
+            }
+            REQUIRE(v.is_inline());
+            v.emplace_back(4);
+            REQUIRE(!v.is_inline());
+            REQUIRE(v.size() == 5);
+            REQUIRE(v[0] == Buffer{0});
+            REQUIRE(v[4] == Buffer{4});
+        }SECTION("Reserve"){
+            small_vector<Buffer, 4> v{};
+            v.reserve(0);
+            v.reserve(4);
+            REQUIRE(v.is_inline());
+            v.reserve(10);
+            REQUIRE(!v.is_inline());
+            REQUIRE(v.capacity() == 10);
+        }SECTION("Erase"){
+            small_vector<Buffer, 8> v{Buffer{1}, Buffer{2}, Buffer{3}, Buffer{4}, Buffer{5}};
+            VectorIterator<Buffer, false> it = std::find(v.begin(), v.end(), Buffer{4});
+            v.erase(it);
+            REQUIRE(v.size() == 4);
+            REQUIRE(v[3] == Buffer{5});
+            v.erase(v.begin(), v.begin() + 2);
+            REQUIRE(v[0] == Buffer{3});
+        }SECTION("Swap"){
+            small_vector<Buffer, 2> a{Buffer{1}};
+            small_vector<Buffer, 2> b{Buffer{2}, Buffer{3}};
+            a.swap(b);
+            REQUIRE(a.size() == 2);
+            REQUIRE(a[1] == Buffer{3});
+            REQUIRE(b.size() == 1);
+            REQUIRE(b[0] == Buffer{1});
+            small_vector<Buffer, 2> c{Buffer{4}, Buffer{5}, Buffer{6}};
+            a.swap(c);
+            REQUIRE(a.size() == 3);
+            REQUIRE(!a.is_inline());
+            REQUIRE(c.is_inline());
+            REQUIRE(c[1] == Buffer{3});
+            c.swap(a);
+            REQUIRE(c.size() == 3);
+            REQUIRE(a.is_inline());
+            REQUIRE(a[0] == Buffer{2});
+            small_vector<Buffer, 2> d{Buffer{7}, Buffer{8}, Buffer{9}};
+            c.swap(d);
+            REQUIRE(c[0] == Buffer{7});
+            REQUIRE(d[2] == Buffer{6});
+            using std::swap;
+            swap(a, b);
+            REQUIRE(a.is_inline());
+            REQUIRE(a[0] == Buffer{1});
+            REQUIRE(b[0] == Buffer{2});
+            using base = vector<Buffer, MyVec::small_buffer_allocator<Buffer, 2>>;
+            STATIC_REQUIRE_FALSE(member_swappable<small_vector<Buffer, 2>, base>);
+        }
+    }
+}
+
+TEST_CASE("Small vector (shared_ptr<string>)"){
+    using MyVec::small_vector;
+    SECTION("Constructors"){
+        SECTION("By size and value"){
+            shared_ptr<string> p = make_shared<string>("1");
+            {
+                small_vector<shared_ptr<string>, 4> v(6, p);
+                REQUIRE(v.size() == 6);
+                REQUIRE(p.use_count() == 7);
+            }
+            REQUIRE(p.use_count() == 1);
+        }SECTION("Move - inline"){
+            shared_ptr<string> p = make_shared<string>("1");
+            small_vector<shared_ptr<string>, 4> v{p, p};
+            small_vector<shared_ptr<string>, 4> v2{std::move(v)};
+            REQUIRE(v2.size() == 2);
+            REQUIRE(p.use_count() == 3);
+        }
+    }
+
+    SECTION("Methods"){
+        SECTION("Push back and erase"){
+            shared_ptr<string> p = make_shared<string>("1");
+            small_vector<shared_ptr<string>, 2> v{};
+            v.push_back(p);
+            v.push_back(make_shared<string>("2"));
+            v.push_back(make_shared<string>("3"));
+            REQUIRE(!v.is_inline());
+            REQUIRE(*v[2] == "3");
+            v.erase(v.begin());
+            REQUIRE(p.use_count() == 1);
+            REQUIRE(*v[0] == "2");
+        }SECTION("Swap"){
+            shared_ptr<string> p = make_shared<string>("1");
+            small_vector<shared_ptr<string>, 2> a{p};
+            small_vector<shared_ptr<string>, 2> b{p, p, p};
+            a.swap(b);
+            REQUIRE(a.size() == 3);
+            REQUIRE(b.size() == 1);
+            REQUIRE(p.use_count() == 5);
+        }SECTION("Insert in the middle with throwing move"){
+            // Перемещение может бросить исключение, поэтому вставка не сдвигает хвост move-конструктором
+            struct Copyable {
+                string value;
+                explicit Copyable(const char *value) : value{value}{}
+                Copyable(const Copyable &second) : value{second.value}{}
+                Copyable &operator=(const Copyable &) = default;
+            };
+            static_assert(!std::is_nothrow_move_constructible_v<Copyable>);
+            small_vector<Copyable, 4> v{};
+            v.push_back(Copyable("a"));
+            v.push_back(Copyable("b"));
+            v.push_back(Copyable("c"));
+            v.insert(v.begin() + 1, Copyable("X"));
+            REQUIRE(v.is_inline());
+            REQUIRE(v.size() == 4);
+            string joined;
+            for (const Copyable &element: v){
+                joined += element.value;
+            }
+            REQUIRE(joined == "aXbc");
+            v.insert(v.begin() + 2, Copyable("Y"));
+            REQUIRE(!v.is_inline());
+            joined.clear();
+            for (const Copyable &element: v){
+                joined += element.value;
+            }
+            REQUIRE(joined == "aXYbc");
+            small_vector<Copyable, 4> w{};
+            w.push_back(Copyable("d"));
+            w.swap(v);
+            w.insert(w.begin(), Copyable("Z"));
+            v.insert(v.begin(), Copyable("e"));
+            REQUIRE(v.is_inline());
+            REQUIRE(v.size() == 2);
+            REQUIRE(v[0].value == "e");
+            REQUIRE(v[1].value == "d");
+            REQUIRE(w[0].value == "Z");
+            REQUIRE(w[5].value == "c");
+        }
+    }
+}
+
+
+TEST_CASE("Growth policies"){
+    SECTION("Doubling"){
+        vector<int, std::allocator<int>, MyVec::doubling_growth> v{};
+        v.push_back(1);
+        REQUIRE(v.capacity() == 1);
+        v.push_back(2);
+        v.push_back(3);
+        REQUIRE(v.capacity() == 4);
+    }SECTION("1.5x"){
+        vector<string, std::allocator<string>, MyVec::half_growth> v{};
+        std::size_t expected[] = {1, 2, 3, 4, 6, 6, 9, 9, 9};
+        for (std::size_t i = 0; i < 9; i++){
+            v.push_back(std::to_string(i));
+            REQUIRE(v.capacity() == expected[i]);
+        }
+        REQUIRE(v[8] == "8");
+    }SECTION("Page rounded"){
+        vector<Buffer, std::allocator<Buffer>, MyVec::page_growth<>> v{};
+        for (int i = 0; i < 1000; i++){
+            v.emplace_back(1);
+        }
+        REQUIRE(v.capacity() * sizeof(Buffer) % 4096 == 0);
+        REQUIRE(v.back() == Buffer{1});
+    }SECTION("Size class"){
+        using policy = MyVec::size_class_growth<>;
+        REQUIRE(policy::malloc_size_class(1) == 24);
+        REQUIRE(policy::malloc_size_class(24) == 24);
+        REQUIRE(policy::malloc_size_class(25) == 40);
+        REQUIRE(policy::malloc_size_class(1 << 20) % 4096 == 4096 - 16);
+        vector<int, std::allocator<int>, policy> v{};
+        v.push_back(1);
+        REQUIRE(v.capacity() == 6);
+        for (int i = 0; i < 100; i++){
+            v.push_back(i);
+        }
+        REQUIRE((v.capacity() * sizeof(int) + 8) % 16 == 0);
+    }SECTION("Allocator reported size (shared_ptr<string>)"){
+        vector<shared_ptr<string>, MyVec::realloc_allocator<shared_ptr<string>>> v{};
+        v.push_back(make_shared<string>("1"));
+        REQUIRE(v.capacity() >= 1);
+        v.reserve(3);
+        REQUIRE(v.capacity() >= 3);
+        for (int i = 0; i < 100; i++){
+            v.push_back(make_shared<string>(std::to_string(i)));
+        }
+        REQUIRE(*v[100] == "99");
+    }SECTION("pmr with policy"){
+        CountingResource res;
+        MyVec::pmr::vector<int, MyVec::half_growth> v{&res};
+        for (int i = 0; i < 10; i++){
+            v.push_back(i);
+        }
+        REQUIRE(v.capacity() == 13);
+        REQUIRE(res.bytes == 13 * sizeof(int));
+    }
+}
+
+
+TEST_CASE("Range insertion"){
+    SECTION("Constructors"){
+        SECTION("By iterators (string)"){
+            std::array<string, 3> source{"1", "2", "3"};
+            vector<string> v(source.begin(), source.end());
+            REQUIRE(v.size() == 3);
+            REQUIRE(v.capacity() == 3);
+            REQUIRE(v[2] == "3");
+        }SECTION("By input iterators (int)"){
+            std::istringstream stream("1 2 3 4 5");
+            vector<int> v{std::istream_iterator<int>(stream), std::istream_iterator<int>()};
+            REQUIRE(v.size() == 5);
+            REQUIRE(v[4] == 5);
+        }SECTION("From range (Buffer)"){
+            vector<Buffer> source{Buffer{1}, Buffer{2}};
+            vector<Buffer> v(MyVec::from_range, source);
+            REQUIRE(v.size() == 2);
+            REQUIRE(v[1] == Buffer{2});
+        }
+    }
+
+    SECTION("Insert"){
+        SECTION("Range into middle with reallocation (string)"){
+            vector<string> v{"1", "5"};
+            std::array<string, 3> source{"2", "3", "4"};
+            VectorIterator<string, false> it = v.insert(v.begin() + 1, source.begin(), source.end());
+            REQUIRE(*it == "2");
+            REQUIRE(v.size() == 5);
+            for (int i = 0; i < 5; i++){
+                REQUIRE(v[i] == std::to_string(i + 1));
+            }
+        }SECTION("Range into middle without reallocation (string)"){
+            vector<string> v{"1", "4", "5"};
+            v.reserve(10);
+            std::array<string, 2> source{"2", "3"};
+            v.insert(v.begin() + 1, source.begin(), source.end());
+            REQUIRE(v.capacity() == 10);
+            for (int i = 0; i < 5; i++){
+                REQUIRE(v[i] == std::to_string(i + 1));
+            }
+        }SECTION("Range of int with single allocation"){
+            CountingResource res;
+            MyVec::pmr::vector<int> v{&res};
+            std::array<int, 100> source{};
+            std::iota(source.begin(), source.end(), 0);
+            v.insert(v.end(), source.begin(), source.end());
+            REQUIRE(res.allocations == 1);
+            REQUIRE(v.size() == 100);
+            REQUIRE(v[99] == 99);
+        }SECTION("Input range into middle (int)"){
+            vector<int> v{1, 5};
+            std::istringstream stream("2 3 4");
+            v.insert(v.begin() + 1, std::istream_iterator<int>(stream), std::istream_iterator<int>());
+            REQUIRE(v.size() == 5);
+            for (int i = 0; i < 5; i++){
+                REQUIRE(v[i] == i + 1);
+            }
+        }SECTION("N copies of own element (Buffer)"){
+            vector<Buffer> v{Buffer{1}, Buffer{2}};
+            v.insert(v.begin(), 3, v[1]);
+            REQUIRE(v.size() == 5);
+            REQUIRE(v[0] == Buffer{2});
+            REQUIRE(v[2] == Buffer{2});
+            REQUIRE(v[3] == Buffer{1});
+            v.reserve(20);
+            v.insert(v.begin() + 4, 2, v[3]);
+            REQUIRE(v.size() == 7);
+            REQUIRE(v[4] == Buffer{1});
+            REQUIRE(v[6] == Buffer{2});
+        }SECTION("Insert range (shared_ptr<string>)"){
+            shared_ptr<string> p = make_shared<string>("1");
+            vector<shared_ptr<string>> v{p, p};
+            vector<shared_ptr<string>> source{3, make_shared<string>("2")};
+            v.insert_range(v.begin() + 1, source);
+            REQUIRE(v.size() == 5);
+            REQUIRE(*v[1] == "2");
+            REQUIRE(v[4] == p);
+            REQUIRE(p.use_count() == 3);
+        }
+    }
+
+    SECTION("Append and assign"){
+        SECTION("Append range (string)"){
+            vector<string> v{"1"};
+            v.append_range(std::vector<string>{"2", "3"});
+            REQUIRE(v.size() == 3);
+            REQUIRE(v[2] == "3");
+            v.append_range(std::views::iota(4, 6) | std::views::transform([](int i){ return std::to_string(i); }));
+            REQUIRE(v.size() == 5);
+            REQUIRE(v[4] == "5");
+        }SECTION("Assign range (Buffer)"){
+            vector<Buffer> v{Buffer{1}, Buffer{2}, Buffer{3}};
+            v.assign_range(std::array<Buffer, 2>{Buffer{4}, Buffer{5}});
+            REQUIRE(v.size() == 2);
+            REQUIRE(v[0] == Buffer{4});
+            v.assign_range(vector<Buffer>{5, Buffer{6}});
+            REQUIRE(v.size() == 5);
+            REQUIRE(v[4] == Buffer{6});
+        }
+    }
+}
+
+
+TEST_CASE("Resize and append window"){
+    SECTION("Resize (string)"){
+        vector<string> v{"1", "2", "3"};
+        v.resize(5);
+        REQUIRE(v.size() == 5);
+        REQUIRE(v[4].empty());
+        v.resize(2);
+        REQUIRE(v.size() == 2);
+        REQUIRE(v[1] == "2");
+        v.resize(6, v[0]);
+        REQUIRE(v.size() == 6);
+        REQUIRE(v[5] == "1");
+    }SECTION("Resize (Buffer)"){
+        vector<Buffer> v{};
+        v.resize(3, Buffer{2});
+        REQUIRE(v.size() == 3);
+        REQUIRE(v[2] == Buffer{2});
+        v.resize(1);
+        REQUIRE(v.size() == 1);
+    }SECTION("Resize (shared_ptr<string>)"){
+        shared_ptr<string> p = make_shared<string>("1");
+        vector<shared_ptr<string>> v{3, p};
+        v.resize(10);
+        REQUIRE(v[9] == nullptr);
+        v.resize(1);
+        REQUIRE(p.use_count() == 2);
+    }SECTION("Resize for overwrite (float)"){
+        vector<float> v{1.0f};
+        v.resize_for_overwrite(100);
+        REQUIRE(v.size() == 100);
+        REQUIRE(v[0] == 1.0f);
+        for (std::size_t i = 0; i < v.size(); i++){
+            v[i] = static_cast<float>(i);
+        }
+        REQUIRE(v[99] == 99.0f);
+        v.resize_for_overwrite(10);
+        REQUIRE(v.size() == 10);
+    }SECTION("Append window (uint8_t)"){
+        const string frame = "Wait, placement new is an answer?";
+        std::size_t offset = 0;
+        // Имитация recv(), отдающего данные кусками по 5 байт
+        auto receive = [&](std::uint8_t *dest, std::size_t size){
+            std::size_t n = std::min({size, std::size_t{5}, frame.size() - offset});
+            std::memcpy(dest, frame.data() + offset, n);
+            offset += n;
+            return n;
+        };
+        vector<std::uint8_t> v{};
+        while (offset < frame.size()){
+            std::span<std::uint8_t> window = v.append_window(16);
+            REQUIRE(window.size() == 16);
+            REQUIRE(v.capacity() >= v.size() + 16);
+            v.commit_append(receive(window.data(), window.size()));
+        }
+        REQUIRE(v.size() == frame.size());
+        REQUIRE(string(v.begin(), v.end()) == frame);
+    }
+}
+
+
+TEST_CASE("SIMD algorithms"){
+    SECTION("Find, count, contains (int32_t)"){
+        vector<std::int32_t> v{};
+        for (std::int32_t i = 0; i < 1000; i++){
+            v.push_back(i % 100);
+        }
+        REQUIRE(MyVec::simd::find(v, 42) - v.begin() == 42);
+        REQUIRE(MyVec::simd::find(v, 1000) == v.end());
+        REQUIRE(MyVec::simd::count(v, 7) == 10);
+        REQUIRE(MyVec::simd::contains(v, 99));
+        REQUIRE(!MyVec::simd::contains(v, -1));
+        v[997] = -1;
+        REQUIRE(MyVec::simd::find(v, -1) - v.begin() == 997);
+    }SECTION("Min, max, sum, dot (uint8_t)"){
+        vector<std::uint8_t> v{};
+        for (int i = 0; i < 1000; i++){
+            v.push_back(static_cast<std::uint8_t>(i * 7 % 251));
+        }
+        auto [lo, hi] = MyVec::simd::minmax(v);
+        REQUIRE(lo == *std::min_element(v.begin(), v.end()));
+        REQUIRE(hi == *std::max_element(v.begin(), v.end()));
+        REQUIRE(MyVec::simd::sum(v) == std::accumulate(v.begin(), v.end(), std::uint64_t{0}));
+        REQUIRE(MyVec::simd::dot(v, v) == std::inner_product(v.begin(), v.end(), v.begin(), std::uint64_t{0}));
+        REQUIRE_THROWS(MyVec::simd::min(vector<std::uint8_t>{}));
+    }SECTION("Float"){
+        vector<float> v{};
+        for (int i = 0; i < 333; i++){
+            v.push_back(static_cast<float>(i) * 0.5f);
+        }
+        REQUIRE(MyVec::simd::min(v) == 0.0f);
+        REQUIRE(MyVec::simd::max(v) == 166.0f);
+        REQUIRE(MyVec::simd::sum(v) == Approx(std::accumulate(v.begin(), v.end(), 0.0)));
+        REQUIRE(MyVec::simd::find(v, 100.5f) - v.begin() == 201);
+    }SECTION("Mismatch and equal (int64_t)"){
+        vector<std::int64_t> a{}, b{};
+        for (std::int64_t i = 0; i < 100; i++){
+            a.push_back(i);
+            b.push_back(i);
+        }
+        REQUIRE(MyVec::simd::equal(a, b));
+        b[63] = -1;
+        REQUIRE(!MyVec::simd::equal(a, b));
+        REQUIRE(MyVec::simd::mismatch(a, b).first - a.cbegin() == 63);
+        b.resize(50);
+        REQUIRE(MyVec::simd::mismatch(a, b).first - a.cbegin() == 50);
+        REQUIRE_THROWS(MyVec::simd::dot(a, b));
+    }SECTION("Value converts to the element type"){
+        vector<long> v{1, 2, 1, 3};
+        REQUIRE(MyVec::simd::count(v, 1) == 2);
+        REQUIRE(MyVec::simd::find(v, 3) - v.begin() == 3);
+        REQUIRE(MyVec::simd::contains(std::as_const(v), 2));
+    }SECTION("Each implementation (uint8_t)"){
+        // Больше 127 * lanes элементов даже для AVX-512, чтобы счётчики count сбрасывались по блокам
+        std::vector<std::uint8_t> bytes(127 * 64 * 3 + 17, 3);
+        for (std::size_t i = 0; i < bytes.size(); i += 5){
+            bytes[i] = static_cast<std::uint8_t>(i % 251);
+        }
+        const std::uint8_t *p = bytes.data();
+        std::size_t n = bytes.size();
+        auto check = [&](auto k){
+            REQUIRE(k.count(p, n, std::uint8_t{3}) == static_cast<std::size_t>(std::count(bytes.begin(), bytes.end(), 3)));
+            REQUIRE(k.find(p, n, std::uint8_t{250}) == static_cast<std::size_t>(std::find(bytes.begin(), bytes.end(), 250) - bytes.begin()));
+            REQUIRE(k.find(p, n, std::uint8_t{255}) == n);
+            auto [lo, hi] = std::minmax_element(bytes.begin(), bytes.end());
+            REQUIRE(k.minmax(p, n) == std::pair{*lo, *hi});
+            REQUIRE(k.sum(p, n) == std::accumulate(bytes.begin(), bytes.end(), std::uint64_t{0}));
+            REQUIRE(k.dot(p, p, n) == std::inner_product(bytes.begin(), bytes.end(), bytes.begin(), std::uint64_t{0}));
+            REQUIRE(k.mismatch(p, p, n) == n);
+        };
+        check(MyVec::simd::detail::scalar{});
+#if defined(__x86_64__) || defined(__i386__)
+        using MyVec::simd::isa;
+        if (MyVec::simd::current_isa() >= isa::sse2){
+            check(MyVec::simd::detail::sse2{});
+        }
+        if (MyVec::simd::current_isa() >= isa::avx2){
+            check(MyVec::simd::detail::avx2{});
+        }
+        if (MyVec::simd::current_isa() >= isa::avx512){
+            check(MyVec::simd::detail::avx512{});
+        }
+#endif
+    }
+}
+
+/// Тип, считающий живые экземпляры и бросающий исключение на заданном по счёту копировании
+struct Counted {
+    static inline std::atomic<long> alive = 0;
+    static inline std::atomic<long> copiesLeft = -1;
+    int value = 0;
+
+    Counted(){ alive++; }
+    explicit Counted(int value) : value{value}{ alive++; }
+    Counted(const Counted &second) : value{second.value}{
+        if (--copiesLeft == 0){
+            throw std::runtime_error("Copy failed");
+        }
+        alive++;
+    }
+    Counted &operator=(const Counted &) = default;
+    ~Counted(){ alive--; }
+};
+
+TEST_CASE("Parallel construction"){
+    const MyVec::parallel_policy policy{.threads = 4, .grain = 1000};
+    SECTION("By size (int)"){
+        vector<int> v(policy, 100000);
+        REQUIRE(v.size() == 100000);
+        REQUIRE(std::count(v.begin(), v.end(), 0) == 100000);
+    }SECTION("By size and value (string)"){
+        vector<string> v(policy, 50000, "123");
+        REQUIRE(v.size() == 50000);
+        REQUIRE(v[0] == "123");
+        REQUIRE(v[49999] == "123");
+    }SECTION("Small sizes are serial (Buffer)"){
+        vector<Buffer> v(MyVec::parallel, 10, Buffer{2});
+        REQUIRE(v.size() == 10);
+        REQUIRE(v[9] == Buffer{2});
+    }SECTION("Copy (shared_ptr<string>)"){
+        shared_ptr<string> p = make_shared<string>("1");
+        vector<shared_ptr<string>> v(policy, 20000, p);
+        vector<shared_ptr<string>> v2(policy, v);
+        REQUIRE(v2.size() == 20000);
+        REQUIRE(p.use_count() == 40001);
+    }SECTION("Copy assignment (double)"){
+        vector<double> v(policy, 30000, 1.5);
+        vector<double> v2{1.0, 2.0};
+        v2.assign(policy, v);
+        REQUIRE(v2.size() == 30000);
+        REQUIRE(v2[29999] == 1.5);
+        vector<double> v3(100000, 0.0);
+        v3.assign(policy, v);
+        REQUIRE(v3.size() == 30000);
+        REQUIRE(v3.capacity() == 100000);
+    }SECTION("Exception destroys constructed elements"){
+        {
+            Counted c{5};
+            Counted::copiesLeft = 25000;
+            REQUIRE_THROWS_AS(vector<Counted>(policy, 40000, c), std::runtime_error);
+            Counted::copiesLeft = -1;
+            REQUIRE(Counted::alive == 1);
+            vector<Counted> v(policy, 40000, c);
+            Counted::copiesLeft = 30000;
+            REQUIRE_THROWS_AS(vector<Counted>(policy, v), std::runtime_error);
+            Counted::copiesLeft = -1;
+            REQUIRE(Counted::alive == 40001);
+        }
+        REQUIRE(Counted::alive == 0);
+    }
+}
+
+struct TelemetryTestTag {
+    static constexpr const char *name = "tests.telemetry";
+};
+
+struct QuotedTelemetryTag {
+    static constexpr const char *name = "tests.\"quoted\"\\tag";
+};
+
+struct LateTelemetryTag {
+    static constexpr const char *name = "tests.late";
+};
+
+TEST_CASE("Telemetry"){
+    using telemetry = MyVec::telemetry<TelemetryTestTag>;
+    using tracked = vector<string, std::allocator<string>, MyVec::doubling_growth, telemetry>;
+    static_assert(sizeof(tracked) == sizeof(vector<string>));
+    MyVec::telemetry_registry &registry = MyVec::telemetry_registry::instance();
+    registry.reset();
+    auto counters = [&registry](){
+        for (const MyVec::telemetry_snapshot &s: registry.snapshot()){
+            if (s.tag == TelemetryTestTag::name){
+                return s;
+            }
+        }
+        return MyVec::telemetry_snapshot{};
+    };
+    SECTION("Growth without reserve"){
+        {
+            tracked v;
+            for (int i = 0; i < 5; i++){
+                v.push_back(std::to_string(i));
+            }
+            // Ёмкости 1, 2, 4, 8
+            MyVec::telemetry_snapshot s = counters();
+            REQUIRE(s.allocations == 4);
+            REQUIRE(s.reallocations == 3);
+            REQUIRE(s.deallocations == 3);
+            REQUIRE(s.relocated_elements == 1 + 2 + 4);
+            REQUIRE(s.relocated_bytes == 7 * sizeof(string));
+            REQUIRE(s.bytes_allocated == 15 * sizeof(string));
+            REQUIRE(s.peak_capacity == 8);
+            REQUIRE(s.growth[1] == 1);
+            REQUIRE(s.growth[2] == 1);
+            REQUIRE(s.growth[3] == 1);
+        }
+        MyVec::telemetry_snapshot s = counters();
+        REQUIRE(s.destroyed == 1);
+        REQUIRE(s.wasted_capacity == 3);
+        REQUIRE(s.wasted_bytes == 3 * sizeof(string));
+        REQUIRE(s.bytes_freed == s.bytes_allocated);
+    }SECTION("Reserve"){
+        tracked v;
+        v.reserve(100);
+        for (int i = 0; i < 100; i++){
+            v.emplace_back("1");
+        }
+        MyVec::telemetry_snapshot s = counters();
+        REQUIRE(s.allocations == 1);
+        REQUIRE(s.reallocations == 0);
+        REQUIRE(s.relocated_elements == 0);
+    }SECTION("JSON"){
+        {
+            tracked v{"1", "2"};
+            v.push_back("3");
+        }
+        std::ostringstream out;
+        registry.dump_json(out);
+        string json = out.str();
+        REQUIRE(json.find("\"tests.telemetry\": {\"allocations\": 2") != string::npos);
+        REQUIRE(json.find("\"growth_histogram\": {\"4\": 1}") != string::npos);
+        registry.reset();
+        REQUIRE(counters().allocations == 0);
+    }SECTION("Tags are registered before the first event"){
+        // Хуки не регистрируют тег сами: он уже есть в реестре со статической инициализации
+        auto registered = [&registry](){
+            for (const MyVec::telemetry_snapshot &s: registry.snapshot()){
+                if (s.tag == LateTelemetryTag::name){
+                    return true;
+                }
+            }
+            return false;
+        };
+        REQUIRE(registered());
+        static_assert(noexcept(MyVec::telemetry<LateTelemetryTag>::counters()));
+        vector<int, std::allocator<int>, MyVec::doubling_growth, MyVec::telemetry<LateTelemetryTag>> v{1, 2};
+        REQUIRE(MyVec::telemetry<LateTelemetryTag>::counters().allocations == 1);
+    }SECTION("JSON escapes tag names"){
+        {
+            vector<int, std::allocator<int>, MyVec::doubling_growth, MyVec::telemetry<QuotedTelemetryTag>> v{1};
+        }
+        std::ostringstream out;
+        registry.dump_json(out);
+        REQUIRE(out.str().find("\"tests.\\\"quoted\\\"\\\\tag\": {") != string::npos);
+    }SECTION("SIMD algorithms"){
+        vector<int, std::allocator<int>, MyVec::doubling_growth, telemetry> v{1, 2, 3, 2};
+        REQUIRE(MyVec::simd::count(v, 2) == 2);
+        REQUIRE(MyVec::simd::find(v, 3) - v.begin() == 2);
+        REQUIRE(MyVec::simd::sum(v) == 8);
+        REQUIRE(MyVec::simd::minmax(v) == std::pair{1, 3});
+        REQUIRE(MyVec::simd::equal(v, vector<int>{1, 2, 3, 2}));
+        REQUIRE(MyVec::simd::dot(v, vector<int>{1, 1, 1, 1}) == 8);
+    }
+}
+
+TEST_CASE("Memory-mapped vector"){
+    struct Record {
+        std::uint64_t id;
+        double value;
+    };
+    using MyVec::mmap_mode;
+    std::string path = (std::filesystem::temp_directory_path() / "myvec_mmap_vector_test.bin").string();
+    std::filesystem::remove(path);
+    static_assert(std::is_same_v<MyVec::mmap_vector<int>::iterator, vector<int>::iterator>);
+
+    SECTION("Write, reopen read-only"){
+        {
+            MyVec::mmap_vector<Record> v(path, mmap_mode::read_write);
+            REQUIRE(v.empty());
+            for (std::uint64_t i = 0; i < 10000; i++){
+                v.push_back({i, i * 0.5});
+            }
+            v.emplace_back(Record{10000, 5000.0});
+            REQUIRE(v.size() == 10001);
+            REQUIRE(v.capacity() >= 10001);
+            v.sync();
+        }
+        REQUIRE(std::filesystem::file_size(path) == 10001 * sizeof(Record));
+
+        const MyVec::mmap_vector<Record> v(path);
+        REQUIRE(v.read_only());
+        REQUIRE(v.size() == 10001);
+        REQUIRE(v[1234].id == 1234);
+        REQUIRE(v.back().value == 5000.0);
+        REQUIRE(std::count_if(v.begin(), v.end(), [](const Record &r){ return r.value == r.id * 0.5; }) == 10001);
+        REQUIRE_THROWS_AS(v.at(10001), std::out_of_range);
+    }SECTION("Read-only vector does not change the file"){
+        {
+            MyVec::mmap_vector<int> v(path, mmap_mode::read_write);
+            v.resize(100, 7);
+        }
+        MyVec::mmap_vector<int> v(path);
+        REQUIRE_THROWS_AS(v.push_back(1), std::logic_error);
+        REQUIRE_THROWS_AS(v.reserve(1000), std::logic_error);
+        v[0] = 8;
+        REQUIRE(v.advise(MyVec::mmap_advice::sequential));
+        MyVec::mmap_vector<int> v2(path);
+        REQUIRE(v2[0] == 7);
+    }SECTION("Insert and erase"){
+        MyVec::mmap_vector<int> v(path, mmap_mode::read_write);
+        std::array<int, 4> values{1, 2, 3, 4};
+        v.insert(v.begin(), values.begin(), values.end());
+        v.insert(v.begin() + 2, 3, 0);
+        REQUIRE(std::vector<int>(v.begin(), v.end()) == std::vector<int>{1, 2, 0, 0, 0, 3, 4});
+        v.erase(v.begin() + 2, v.begin() + 5);
+        v.erase(v.begin());
+        REQUIRE(std::vector<int>(v.begin(), v.end()) == std::vector<int>{2, 3, 4});
+        REQUIRE(v.erase(v.end()) == v.end());
+        v.insert(v.begin() + 1, v[2]);
+        v.emplace(v.end(), 5);
+        REQUIRE(std::vector<int>(v.begin(), v.end()) == std::vector<int>{2, 4, 3, 4, 5});
+        MyVec::mmap_vector<int> moved(std::move(v));
+        REQUIRE(moved.size() == 5);
+        REQUIRE(v.empty());
+    }SECTION("Assign"){
+        MyVec::mmap_vector<int> v(path, mmap_mode::read_write);
+        v.assign(1000, 7);
+        REQUIRE(v.size() == 1000);
+        REQUIRE(v[999] == 7);
+        std::list<int> values{1, 2, 3};
+        v.assign(values.begin(), values.end());
+        REQUIRE(std::vector<int>(v.begin(), v.end()) == std::vector<int>{1, 2, 3});
+        v.assign(2, v[2]);
+        REQUIRE(std::vector<int>(v.begin(), v.end()) == std::vector<int>{3, 3});
+    }SECTION("Invalid file"){
+        REQUIRE_THROWS_AS(MyVec::mmap_vector<int>(path), std::system_error);
+        {
+            MyVec::mmap_vector<char> v(path, mmap_mode::read_write);
+            v.push_back('a');
+        }
+        REQUIRE_THROWS_AS(MyVec::mmap_vector<int>(path), std::invalid_argument);
+    }
+    std::filesystem::remove(path);
+}
+
+template <>
+struct MyVec::io::codec<Buffer> {
+    static void encode(const Buffer &value, encoder &out){
+        out.put(value.length());
+        for (int i = 0; i < value.length(); i++){
+            codec<string>::encode(value[i], out);
+        }
+    }
+
+    static Buffer decode(decoder &in){
+        Buffer value(in.get<int>());
+        for (int i = 0; i < value.length(); i++){
+            value[i] = codec<string>::decode(in);
+        }
+        return value;
+    }
+};
+
+TEST_CASE("Snapshots"){
+    namespace io = MyVec::io;
+    std::string path = (std::filesystem::temp_directory_path() / "myvec_snapshot_test.bin").string();
+
+    SECTION("Bulk (int)"){
+        vector<int> v(100000);
+        std::iota(v.begin(), v.end(), 0);
+        io::save(path, v);
+        REQUIRE(std::filesystem::file_size(path) == sizeof(io::header) + 100000 * sizeof(int));
+        vector<int> loaded{1, 2, 3};
+        io::load(path, loaded);
+        REQUIRE(loaded.size() == 100000);
+        REQUIRE(loaded.capacity() == 100000);
+        REQUIRE(std::equal(v.begin(), v.end(), loaded.begin()));
+        REQUIRE(io::load<vector<int>>(path).back() == 99999);
+    }SECTION("Streaming (string, Buffer)"){
+        vector<string> v;
+        for (int i = 0; i < 30000; i++){
+            v.push_back(string(i % 100, 'a' + i % 26));
+        }
+        io::save(path, v);
+        auto loaded = io::load<vector<string>>(path);
+        REQUIRE(loaded.size() == v.size());
+        REQUIRE(std::equal(v.begin(), v.end(), loaded.begin()));
+
+        vector<Buffer> buffers(3, Buffer(2));
+        buffers[1][0] = "first";
+        buffers[2][1] = string(5000000, 'x');
+        io::save(path, buffers);
+        auto loadedBuffers = io::load<vector<Buffer>>(path);
+        REQUIRE(loadedBuffers.size() == 3);
+        REQUIRE(loadedBuffers[1][0] == "first");
+        REQUIRE(loadedBuffers[2] == buffers[2]);
+    }SECTION("Several snapshots in one file"){
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        io::save(fd, vector<double>{1.5, 2.5});
+        io::save(fd, vector<string>{"a", "bc"});
+        ::lseek(fd, 0, SEEK_SET);
+        vector<double> doubles;
+        vector<string> strings;
+        io::load(fd, doubles);
+        io::load(fd, strings);
+        ::close(fd);
+        REQUIRE(doubles[1] == 2.5);
+        REQUIRE(strings[1] == "bc");
+    }SECTION("Errors"){
+        io::save(path, vector<int>{1, 2, 3});
+        vector<int> ints{7};
+        REQUIRE_THROWS_AS(io::load<vector<long long>>(path), io::format_error);
+        REQUIRE_THROWS_AS(io::load<vector<string>>(path), io::format_error);
+        {
+            int fd = ::open(path.c_str(), O_WRONLY);
+            int corrupted = 5;
+            ::pwrite(fd, &corrupted, sizeof(int), sizeof(io::header));
+            ::close(fd);
+        }
+        REQUIRE_THROWS_AS(io::load(path, ints), io::format_error);
+        REQUIRE(ints.size() == 1);
+        io::load(path, ints, false);
+        REQUIRE(ints[0] == 5);
+        std::filesystem::resize_file(path, sizeof(io::header) + 4);
+        REQUIRE_THROWS_AS(io::load(path, ints), io::format_error);
+        REQUIRE_THROWS_AS(io::load<vector<int>>(path + ".missing"), std::system_error);
+    }SECTION("Corrupted header and lengths"){
+        // Поле заголовка по смещению offset заменяется value
+        auto corrupt = [&path](std::size_t offset, std::uint64_t value){
+            int fd = ::open(path.c_str(), O_WRONLY);
+            REQUIRE(::pwrite(fd, &value, sizeof(value), static_cast<off_t>(offset)) == sizeof(value));
+            ::close(fd);
+        };
+        // count * sizeof(int) переполняется и совпадает с размером данных
+        io::save(path, vector<int>{1, 2, 3});
+        corrupt(offsetof(io::header, count), (std::uint64_t{1} << 62) + 3);
+        REQUIRE_THROWS_AS(io::load<vector<int>>(path), io::format_error);
+        io::save(path, vector<int>{1, 2, 3});
+        corrupt(offsetof(io::header, count), std::uint64_t{1} << 40);
+        corrupt(offsetof(io::header, payload_bytes), std::uint64_t{4} << 40);
+        REQUIRE_THROWS_AS(io::load<vector<int>>(path), io::format_error);
+
+        io::save(path, vector<string>{"ab", "cd"});
+        corrupt(offsetof(io::header, count), std::uint64_t{1} << 50);
+        REQUIRE_THROWS_AS(io::load<vector<string>>(path), io::format_error);
+        io::save(path, vector<string>{"ab", "cd"});
+        corrupt(sizeof(io::header), std::uint64_t{1} << 40);
+        REQUIRE_THROWS_AS(io::load<vector<string>>(path), io::format_error);
+        io::save(path, vector<string>{"ab", "cd"});
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+        REQUIRE_THROWS_AS(io::load<vector<string>>(path), io::format_error);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Aligned storage and pre-faulting"){
+    SECTION("Alignment"){
+        vector<char, MyVec::aligned_allocator<char>> v;
+        for (int i = 0; i < 1000; i++){
+            v.push_back('a');
+            REQUIRE(reinterpret_cast<std::uintptr_t>(v.data()) % 64 == 0);
+        }
+        vector<string, MyVec::aligned_allocator<string, 128>> strings{"1", "2", "3"};
+        strings.push_back("4");
+        REQUIRE(reinterpret_cast<std::uintptr_t>(strings.data()) % 128 == 0);
+        REQUIRE(strings[3] == "4");
+    }SECTION("Huge pages"){
+        using allocator = MyVec::aligned_allocator<int, 64, std::size_t{1} << 20>;
+        vector<int, allocator> v(300000, 1);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(v.data()) % allocator::huge_page_size == 0);
+        v.push_back(2);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(v.data()) % allocator::huge_page_size == 0);
+        REQUIRE(std::accumulate(v.begin(), v.end(), 0) == 300002);
+    }SECTION("Pre-faulted reservation"){
+        vector<std::uint64_t> v{1, 2, 3};
+        v.reserve_prefaulted(100000);
+        REQUIRE(v.capacity() == 100000);
+        REQUIRE(v[2] == 3);
+        // Все страницы блока, включая свободную часть, уже отображены
+        constexpr std::uintptr_t page = 4096;
+        auto begin = reinterpret_cast<std::uintptr_t>(v.data()) / page * page;
+        auto end = reinterpret_cast<std::uintptr_t>(v.data() + v.capacity());
+        std::vector<unsigned char> resident((end - begin + page - 1) / page);
+        REQUIRE(::mincore(reinterpret_cast<void *>(begin), end - begin, resident.data()) == 0);
+        REQUIRE(std::all_of(resident.begin(), resident.end(), [](unsigned char r){ return r & 1; }));
+    }SECTION("Locked pages"){
+        vector<int> v;
+        v.reserve(1024);
+        try {
+            v.lock_pages();
+            v.unlock_pages();
+        } catch (const std::system_error &e){
+            // RLIMIT_MEMLOCK может запрещать закрепление в окружении тестов
+            REQUIRE((e.code().value() == EPERM || e.code().value() == ENOMEM || e.code().value() == EAGAIN));
+        }
+        vector<int>().lock_pages();
+    }
+}
+
+TEST_CASE("Structure of arrays"){
+    using records = MyVec::soa_vector<std::uint64_t, double, int, std::uint8_t>;
+    static_assert(std::random_access_iterator<records::iterator>);
+    static_assert(std::random_access_iterator<records::const_iterator>);
+    static_assert(std::permutable<records::iterator>);
+
+    SECTION("Columns"){
+        records v;
+        for (int i = 0; i < 1000; i++){
+            v.push_back({i, i * 0.5, i % 7, static_cast<std::uint8_t>(i & 1)});
+        }
+        v.emplace_back(1000, 500.0, 6, 0);
+        REQUIRE(v.size() == 1001);
+        std::span<double> prices = v.column<1>();
+        REQUIRE(prices.size() == 1001);
+        REQUIRE(std::accumulate(prices.begin(), prices.end(), 0.0) == 0.5 * 1000 * 1001 / 2);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(prices.data()) % alignof(double) == 0);
+        REQUIRE(std::count(v.column<3>().begin(), v.column<3>().end(), 1) == 500);
+        auto [id, price, qty, flags] = v[10];
+        REQUIRE(id == 10);
+        REQUIRE(price == 5.0);
+        qty = 100;
+        REQUIRE(v.column<2>()[10] == 100);
+        REQUIRE(v.at(1000) == std::tuple<std::uint64_t, double, int, std::uint8_t>{1000, 500.0, 6, 0});
+        REQUIRE_THROWS_AS(v.at(1001), std::out_of_range);
+    }SECTION("Zip iterator"){
+        records v{{3, 1.5, 1, 0}, {1, 2.5, 2, 0}, {2, 0.5, 3, 0}};
+        std::sort(v.begin(), v.end(), [](const auto &a, const auto &b){ return get<1>(a) < get<1>(b); });
+        REQUIRE(std::vector<std::uint64_t>(v.column<0>().begin(), v.column<0>().end()) ==
+                std::vector<std::uint64_t>{2, 3, 1});
+        REQUIRE(std::vector<int>(v.column<2>().begin(), v.column<2>().end()) == std::vector<int>{3, 1, 2});
+        const records &c = v;
+        auto it = std::find_if(c.begin(), c.end(), [](const auto &row){ return get<2>(row) == 1; });
+        REQUIRE(it - c.begin() == 1);
+        records::const_iterator converted = v.begin() + 2;
+        REQUIRE(converted == c.end() - 1);
+        v.erase(v.begin());
+        REQUIRE(v.size() == 2);
+        REQUIRE(get<0>(v[0]) == 3);
+    }SECTION("Non-trivial columns"){
+        MyVec::soa_vector<string, Buffer, shared_ptr<string>> v;
+        shared_ptr<string> p = make_shared<string>("1");
+        for (int i = 0; i < 100; i++){
+            v.emplace_back(std::to_string(i), Buffer(2), p);
+        }
+        REQUIRE(p.use_count() == 101);
+        auto copy = v;
+        REQUIRE(p.use_count() == 201);
+        REQUIRE(copy.column<0>()[99] == "99");
+        v.clear();
+        REQUIRE(p.use_count() == 101);
+        v = std::move(copy);
+        REQUIRE(v.size() == 100);
+        v.pop_back();
+        REQUIRE(p.use_count() == 100);
+    }SECTION("Growth with throwing copies keeps old rows"){
+        {
+            MyVec::soa_vector<int, Counted> v;
+            v.reserve(4);
+            for (int i = 0; i < 4; i++){
+                v.emplace_back(i, Counted{i});
+            }
+            Counted::copiesLeft = 3;
+            REQUIRE_THROWS_AS(v.emplace_back(4, Counted{4}), std::runtime_error);
+            Counted::copiesLeft = -1;
+            REQUIRE(v.size() == 4);
+            REQUIRE(v.capacity() == 4);
+            REQUIRE(v.column<1>()[3].value == 3);
+            REQUIRE(Counted::alive == 4);
+        }
+        REQUIRE(Counted::alive == 0);
+    }
+}
+
+TEST_CASE("Concurrent vector"){
+    static_assert(std::random_access_iterator<MyVec::concurrent_vector<int>::iterator>);
+    static_assert(std::random_access_iterator<MyVec::concurrent_vector<int>::const_iterator>);
+    static_assert(std::sortable<MyVec::concurrent_vector<int>::iterator>);
+    SECTION("Push back returns indices (int)"){
+        MyVec::concurrent_vector<int> v;
+        REQUIRE(v.empty());
+        for (int i = 0; i < 5000; i++){
+            REQUIRE(v.push_back(i) == static_cast<std::size_t>(i));
+        }
+        REQUIRE(v.size() == 5000);
+        REQUIRE(v.capacity() >= 5000);
+        REQUIRE(v[4999] == 4999);
+        REQUIRE(v.at(17) == 17);
+        REQUIRE_THROWS_AS(v.at(5000), std::out_of_range);
+        REQUIRE(std::accumulate(v.begin(), v.end(), 0LL) == 4999LL * 5000 / 2);
+        REQUIRE(v.end() - v.begin() == 5000);
+        REQUIRE(*(v.cbegin() + 1234) == 1234);
+    }SECTION("Addresses are stable (string)"){
+        MyVec::concurrent_vector<string> v;
+        v.push_back("first");
+        const string *first = &v[0];
+        for (int i = 0; i < 10000; i++){
+            v.emplace_back(std::to_string(i));
+        }
+        REQUIRE(first == &v[0]);
+        REQUIRE(*first == "first");
+        REQUIRE(v[10000] == "9999");
+    }SECTION("Grow by (Buffer)"){
+        MyVec::concurrent_vector<Buffer> v;
+        REQUIRE(v.grow_by(3) == 0);
+        REQUIRE(v.grow_by(1000, Buffer{2}) == 3);
+        REQUIRE(v.size() == 1003);
+        REQUIRE(v[2] == Buffer{});
+        REQUIRE(v[1002] == Buffer{2});
+    }SECTION("Reserve (double)"){
+        MyVec::concurrent_vector<double> v;
+        v.reserve(10000);
+        REQUIRE(v.capacity() >= 10000);
+        REQUIRE(v.empty());
+    }SECTION("Parallel push back and reads (shared_ptr<string>)"){
+        shared_ptr<string> p = make_shared<string>("1");
+        {
+            MyVec::concurrent_vector<shared_ptr<string>> v;
+            const int threads = 4, perThread = 20000;
+            std::atomic<bool> seenNull{false};
+            std::vector<std::thread> workers;
+            for (int t = 0; t < threads; t++){
+                workers.emplace_back([&]{
+                    for (int i = 0; i < perThread; i++){
+                        std::size_t index = v.push_back(p);
+                        if (v[index] == nullptr){
+                            seenNull = true;
+                        }
+                    }
+                });
+            }
+            workers.emplace_back([&]{
+                std::size_t seen = 0;
+                while (seen < threads * perThread){
+                    std::size_t size = v.size();
+                    for (; seen < size; seen++){
+                        if (v[seen] == nullptr){
+                            seenNull = true;
+                        }
+                    }
+                }
+            });
+            for (auto &worker: workers){
+                worker.join();
+            }
+            REQUIRE_FALSE(seenNull);
+            REQUIRE(v.size() == threads * perThread);
+            REQUIRE(p.use_count() == threads * perThread + 1);
+        }
+        REQUIRE(p.use_count() == 1);
+    }SECTION("Parallel grow by (int)"){
+        MyVec::concurrent_vector<int> v;
+        std::vector<std::thread> workers;
+        for (int t = 0; t < 4; t++){
+            workers.emplace_back([&v, t]{
+                for (int i = 0; i < 500; i++){
+                    std::size_t first = v.grow_by(7);
+                    for (std::size_t j = first; j < first + 7; j++){
+                        v[j] = t;
+                    }
+                }
+            });
+        }
+        for (auto &worker: workers){
+            worker.join();
+        }
+        REQUIRE(v.size() == 4 * 500 * 7);
+        std::sort(v.begin(), v.end());
+        REQUIRE(std::count(v.begin(), v.end(), 3) == 500 * 7);
+    }SECTION("Throwing construction (Counted)"){
+        {
+            MyVec::concurrent_vector<Counted> v;
+            v.push_back(Counted{1});
+            Counted c{2};
+            Counted::copiesLeft = 1;
+            REQUIRE_THROWS_AS(v.push_back(c), std::runtime_error);
+            Counted::copiesLeft = -1;
+            REQUIRE(v.size() == 2);
+            REQUIRE_FALSE(v.constructed(1));
+            REQUIRE(v.push_back(c) == 2);
+            REQUIRE(v.size() == 3);
+            REQUIRE(v.constructed(2));
+            REQUIRE(v[2].value == 2);
+            Counted::copiesLeft = 3;
+            REQUIRE_THROWS_AS(v.grow_by(5, c), std::runtime_error);
+            Counted::copiesLeft = -1;
+            REQUIRE(v.size() == 8);
+            REQUIRE(v.constructed(4));
+            REQUIRE_FALSE(v.constructed(5));
+            REQUIRE_FALSE(v.constructed(7));
+            for (int i = 0; i < 10; i++){
+                REQUIRE(v.push_back(Counted{i}) == static_cast<size_t>(8 + i));
+            }
+            REQUIRE(v.size() == 18);
+            REQUIRE(v.at(17).value == 9);
+            REQUIRE(Counted::alive == 1 + 1 + 2 + 10 + 1);
+        }
+        REQUIRE(Counted::alive == 0);
+    }SECTION("Throwing construction fills T() (int)"){
+        struct Throwing {
+            operator int() const{ throw std::runtime_error("Conversion failed"); }
+        };
+        MyVec::concurrent_vector<int> v;
+        v.push_back(1);
+        REQUIRE_THROWS_AS(v.emplace_back(Throwing{}), std::runtime_error);
+        v.push_back(3);
+        REQUIRE(v.size() == 3);
+        REQUIRE(v.constructed(1));
+        REQUIRE(v[1] == 0);
+        REQUIRE(v[2] == 3);
+    }
+}
+
+/// Аллокатор с идентификатором, который передаётся при swap; перемещённый аллокатор получает идентификатор 0
+template <typename T>
+struct SwappingAllocator {
+    using value_type = T;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    int id = 0;
+
+    explicit SwappingAllocator(int id = 0) noexcept : id{id}{}
+    SwappingAllocator(const SwappingAllocator &) noexcept = default;
+    SwappingAllocator(SwappingAllocator &&second) noexcept : id{std::exchange(second.id, 0)}{}
+    SwappingAllocator &operator=(const SwappingAllocator &) noexcept = default;
+
+    T *allocate(std::size_t n){ return std::allocator<T>().allocate(n); }
+    void deallocate(T *p, std::size_t n) noexcept{ std::allocator<T>().deallocate(p, n); }
+    bool operator==(const SwappingAllocator &) const noexcept = default;
+};
+
+TEST_CASE("Incremental growth"){
+    static_assert(std::random_access_iterator<MyVec::incremental_vector<int>::iterator>);
+    static_assert(std::random_access_iterator<MyVec::incremental_vector<int>::const_iterator>);
+    SECTION("Migration spans both blocks (int)"){
+        MyVec::incremental_vector<int> v;
+        for (int i = 0; i < 1024; i++){
+            v.push_back(i);
+        }
+        REQUIRE_FALSE(v.migrating());
+        v.push_back(1024);
+        REQUIRE(v.migrating());
+        REQUIRE(v.capacity() == 2048);
+        for (int i = 0; i < 1025; i++){
+            REQUIRE(v[i] == i);
+        }
+        for (int i = 1025; i < 2048; i++){
+            v.push_back(i);
+            REQUIRE(v[i / 2] == i / 2);
+        }
+        REQUIRE_FALSE(v.migrating());
+        REQUIRE(v.size() == 2048);
+        REQUIRE(std::accumulate(v.begin(), v.end(), 0LL) == 2047LL * 2048 / 2);
+        REQUIRE(v.data()[2047] == 2047);
+    }SECTION("Half growth finishes migration in time (string)"){
+        MyVec::incremental_vector<string, std::allocator<string>, MyVec::half_growth> v;
+        for (int i = 0; i < 10000; i++){
+            v.emplace_back(std::to_string(i));
+            REQUIRE(v.size() <= v.capacity());
+        }
+        for (int i = 0; i < 10000; i++){
+            REQUIRE(v[i] == std::to_string(i));
+        }
+    }SECTION("Push back of own element during growth (Buffer)"){
+        MyVec::incremental_vector<Buffer> v{Buffer{2}, Buffer{3}};
+        v.push_back(v[0]);
+        REQUIRE(v.migrating());
+        v.push_back(v[1]);
+        REQUIRE(v[2] == Buffer{2});
+        REQUIRE(v[3] == Buffer{3});
+    }SECTION("Pop back and copies (shared_ptr<string>)"){
+        shared_ptr<string> p = make_shared<string>("1");
+        {
+            MyVec::incremental_vector<shared_ptr<string>> v;
+            for (int i = 0; i < 65; i++){
+                v.push_back(p);
+            }
+            REQUIRE(v.migrating());
+            auto copy = v;
+            REQUIRE_FALSE(copy.migrating());
+            REQUIRE(p.use_count() == 131);
+            while (v.size() > 10){
+                v.pop_back();
+            }
+            REQUIRE(p.use_count() == 76);
+            v = std::move(copy);
+            REQUIRE(v.size() == 65);
+            v.clear();
+            REQUIRE(v.empty());
+            REQUIRE(p.use_count() == 1);
+            v.reserve(100);
+            REQUIRE(v.capacity() == 100);
+        }
+        REQUIRE(p.use_count() == 1);
+    }SECTION("Throwing migration keeps elements (Counted)"){
+        {
+            MyVec::incremental_vector<Counted> v;
+            for (int i = 0; i < 9; i++){
+                v.emplace_back(i);
+            }
+            REQUIRE(v.migrating());
+            Counted::copiesLeft = 1;
+            REQUIRE_THROWS_AS(v.emplace_back(9), std::runtime_error);
+            Counted::copiesLeft = -1;
+            REQUIRE(v.size() == 9);
+            REQUIRE(Counted::alive == 9);
+            v.finish_migration();
+            for (int i = 0; i < 9; i++){
+                REQUIRE(v[i].value == i);
+            }
+        }
+        REQUIRE(Counted::alive == 0);
+    }SECTION("Move keeps the allocator that owns the blocks (int)"){
+        MyVec::incremental_vector<int, SwappingAllocator<int>> v{SwappingAllocator<int>(1)};
+        for (int i = 0; i < 20; i++){
+            v.push_back(i);
+        }
+        MyVec::incremental_vector<int, SwappingAllocator<int>> moved{std::move(v)};
+        REQUIRE(moved.get_allocator().id == 1);
+        REQUIRE(moved.size() == 20);
+        REQUIRE(moved[19] == 19);
+        REQUIRE(v.empty());
+    }SECTION("Assignment between resources (pmr, Buffer)"){
+        using pmr_incremental = MyVec::incremental_vector<Buffer, std::pmr::polymorphic_allocator<Buffer>>;
+        CountingResource res, res2;
+        {
+            pmr_incremental v{&res};
+            for (int i = 0; i < 20; i++){
+                v.push_back(Buffer{i % 5 + 1});
+            }
+            REQUIRE(v.migrating());
+            pmr_incremental v2{&res2};
+            v2.push_back(Buffer{7});
+            v2 = v;
+            REQUIRE(v2.get_allocator().resource() == &res2);
+            REQUIRE(v2.size() == 20);
+            REQUIRE(v2[19] == Buffer{5});
+            REQUIRE(res2.allocations >= 1);
+            std::size_t before = res.allocations;
+            pmr_incremental v3{&res2};
+            v3 = std::move(v);
+            REQUIRE(v3.get_allocator().resource() == &res2);
+            REQUIRE(v3.size() == 20);
+            REQUIRE(v3[0] == Buffer{1});
+            REQUIRE(v.empty());
+            REQUIRE(res.allocations == before);
+            pmr_incremental v4{&res2};
+            v4 = std::move(v3);
+            REQUIRE(v4.size() == 20);
+            REQUIRE(v3.empty());
+        }
+        REQUIRE(res.bytes == 0);
+        REQUIRE(res2.bytes == 0);
+        REQUIRE(res.allocations == res.deallocations);
+        REQUIRE(res2.allocations == res2.deallocations);
+    }
+}
+
+TEST_CASE("Batch erase"){
+    SECTION("erase_if and erase (int)"){
+        vector<int> v(1000, 0);
+        std::iota(v.begin(), v.end(), 0);
+        REQUIRE(erase_if(v, [](int x){ return x % 3 == 0; }) == 334);
+        REQUIRE(v.size() == 666);
+        REQUIRE(v[0] == 1);
+        REQUIRE(v[1] == 2);
+        REQUIRE(v[2] == 4);
+        REQUIRE(erase(v, 4) == 1);
+        REQUIRE(erase(v, 3) == 0);
+        REQUIRE(v[2] == 5);
+        REQUIRE(v.capacity() == 1000);
+    }SECTION("Retain with mutation (string)"){
+        vector<string> v{"a", "bb", "ccc", "dd", "e"};
+        REQUIRE(v.retain([](string &s){
+            s += "!";
+            return s.size() > 2;
+        }) == 2);
+        REQUIRE(std::ranges::equal(v, std::vector<string>{"bb!", "ccc!", "dd!"}));
+        REQUIRE(v.retain([](string &){ return true; }) == 0);
+        REQUIRE(v.size() == 3);
+    }SECTION("Unordered erase and swap_remove (Buffer)"){
+        vector<Buffer> v{Buffer{1}, Buffer{2}, Buffer{3}, Buffer{4}};
+        auto it = v.unordered_erase(v.begin());
+        REQUIRE(*it == Buffer{4});
+        REQUIRE(v.size() == 3);
+        REQUIRE(v.swap_remove(1) == Buffer{2});
+        REQUIRE(v.size() == 2);
+        REQUIRE(v[1] == Buffer{3});
+        it = v.unordered_erase(v.end() - 1);
+        REQUIRE(it == v.end());
+        REQUIRE(v.size() == 1);
+        REQUIRE_THROWS_AS(v.swap_remove(1), std::out_of_range);
+    }SECTION("Reference counts (shared_ptr<string>)"){
+        shared_ptr<string> p = make_shared<string>("1");
+        shared_ptr<string> q = make_shared<string>("2");
+        vector<shared_ptr<string>> v;
+        for (int i = 0; i < 100; i++){
+            v.push_back(i % 2 ? p : q);
+        }
+        REQUIRE(erase(v, q) == 50);
+        REQUIRE(q.use_count() == 1);
+        REQUIRE(p.use_count() == 51);
+        v.unordered_erase(v.begin() + 10);
+        REQUIRE(p.use_count() == 50);
+        REQUIRE(std::all_of(v.begin(), v.end(), [&p](const auto &e){ return e == p; }));
+    }SECTION("Throwing predicate keeps elements"){
+        vector<int> v(10, 0);
+        std::iota(v.begin(), v.end(), 0);
+        REQUIRE_THROWS_AS(v.retain([](int x){
+            if (x == 6){
+                throw std::runtime_error("stop");
+            }
+            return x % 2 == 0;
+        }), std::runtime_error);
+        REQUIRE(std::ranges::equal(v, std::vector<int>{0, 2, 4, 6, 7, 8, 9}));
+        vector<string> s{"0", "1", "2", "3", "4"};
+        REQUIRE_THROWS_AS(s.retain([](string &x){
+            if (x == "3"){
+                throw std::runtime_error("stop");
+            }
+            return x != "1";
+        }), std::runtime_error);
+        REQUIRE(std::ranges::equal(s, std::vector<string>{"0", "2", "3", "4"}));
+    }
+}
+
+TEST_CASE("Positional insert"){
+    SECTION("Sorted insertion (int)"){
+        vector<int> v;
+        std::vector<int> expected;
+        for (int i = 0; i < 2000; i++){
+            int value = (i * 7919) % 2003;
+            auto it = v.insert(std::lower_bound(v.begin(), v.end(), value), value);
+            REQUIRE(*it == value);
+            expected.insert(std::lower_bound(expected.begin(), expected.end(), value), value);
+        }
+        REQUIRE(std::ranges::equal(v, expected));
+    }SECTION("Own element without reallocation (string)"){
+        vector<string> v{"1", "2", "3"};
+        v.reserve(10);
+        auto it = v.insert(v.begin(), v[2]);
+        REQUIRE(it == v.begin());
+        REQUIRE(std::ranges::equal(v, std::vector<string>{"3", "1", "2", "3"}));
+        v.emplace(v.begin() + 1, v[3]);
+        REQUIRE(std::ranges::equal(v, std::vector<string>{"3", "3", "1", "2", "3"}));
+        v.insert(v.end(), v[2]);
+        REQUIRE(v.back() == "1");
+        REQUIRE(v.capacity() == 10);
+    }SECTION("Own element with reallocation (Buffer)"){
+        vector<Buffer> v{Buffer{1}, Buffer{2}};
+        REQUIRE(v.size() == v.capacity());
+        v.insert(v.begin(), v[1]);
+        REQUIRE(v[0] == Buffer{2});
+        REQUIRE(v[2] == Buffer{2});
+        v.push_back(Buffer{3});
+        REQUIRE(v.size() == v.capacity());
+        v.emplace(v.begin() + 1, v[3]);
+        REQUIRE(v.size() == 5);
+        REQUIRE(v[1] == Buffer{3});
+        REQUIRE(v[4] == Buffer{3});
+    }SECTION("Emplace and move insert (shared_ptr<string>)"){
+        shared_ptr<string> p = make_shared<string>("1");
+        vector<shared_ptr<string>> v{p, p};
+        auto it = v.emplace(v.begin() + 1, make_shared<string>("2"));
+        REQUIRE(**it == "2");
+        shared_ptr<string> q = make_shared<string>("3");
+        v.insert(v.begin(), std::move(q));
+        REQUIRE(q == nullptr);
+        REQUIRE(*v[0] == "3");
+        REQUIRE(*v[2] == "2");
+        REQUIRE(p.use_count() == 3);
+        vector<string> s;
+        s.emplace(s.begin(), 3, 'x');
+        s.emplace(s.begin(), "a");
+        REQUIRE(std::ranges::equal(s, std::vector<string>{"a", "xxx"}));
+    }SECTION("Throwing copy leaves vector unchanged (Counted)"){
+        {
+            vector<Counted> v;
+            v.reserve(8);
+            for (int i = 0; i < 4; i++){
+                v.emplace_back(i);
+            }
+            Counted c{9};
+            Counted::copiesLeft = 1;
+            REQUIRE_THROWS_AS(v.insert(v.begin() + 1, c), std::runtime_error);
+            Counted::copiesLeft = -1;
+            REQUIRE(v.size() == 4);
+            for (int i = 0; i < 4; i++){
+                REQUIRE(v[i].value == i);
+            }
+            v.insert(v.begin() + 1, c);
+            REQUIRE(v[1].value == 9);
+            REQUIRE(v[4].value == 3);
+        }
+        REQUIRE(Counted::alive == 0);
+    }SECTION("Spare capacity shifts in place (Counted)"){
+        {
+            vector<Counted> v;
+            v.reserve(8);
+            for (int i = 0; i < 4; i++){
+                v.emplace_back(i);
+            }
+            const Counted *data = v.data();
+            Counted c{9};
+            v.insert(v.begin() + 1, c);
+            v.insert(v.begin() + 3, 2, c);
+            REQUIRE(v.data() == data);
+            REQUIRE(v.capacity() == 8);
+            int expected[] = {0, 9, 1, 9, 9, 2, 3};
+            REQUIRE(v.size() == 7);
+            for (int i = 0; i < 7; i++){
+                REQUIRE(v[i].value == expected[i]);
+            }
+        }
+        REQUIRE(Counted::alive == 0);
+    }SECTION("Throwing copy of the suffix during growth leaves vector unchanged (Counted)"){
+        {
+            vector<Counted> v;
+            v.reserve(4);
+            for (int i = 0; i < 4; i++){
+                v.emplace_back(i);
+            }
+            REQUIRE(v.capacity() == 4);
+            Counted c{9};
+            // Копии: новый элемент, префикс v[0], суффикс v[1], затем исключение на v[2]
+            Counted::copiesLeft = 4;
+            REQUIRE_THROWS_AS(v.insert(v.begin() + 1, c), std::runtime_error);
+            Counted::copiesLeft = -1;
+            REQUIRE(v.size() == 4);
+            REQUIRE(v.capacity() == 4);
+            for (int i = 0; i < 4; i++){
+                REQUIRE(v[i].value == i);
+            }
+            REQUIRE(Counted::alive == 5);
+        }
+        REQUIRE(Counted::alive == 0);
+    }
+}
+
+TEST_CASE("Assignment reuses storage"){
+    SECTION("Copy assignment keeps capacity and element buffers (string)"){
+        vector<string> v(10, string(40, 'a'));
+        const char *buffer = v[0].data();
+        vector<string> source(3, string(20, 'b'));
+        source.reserve(100);
+        v = source;
+        REQUIRE(v.size() == 3);
+        REQUIRE(v.capacity() == 10);
+        REQUIRE(v[0] == string(20, 'b'));
+        REQUIRE(v[0].data() == buffer);
+        vector<string> bigger(12, "c");
+        bigger.reserve(50);
+        v = bigger;
+        REQUIRE(v.size() == 12);
+        REQUIRE(v.capacity() == 12);
+        REQUIRE(v[11] == "c");
+    }SECTION("Initializer list destroys old elements (shared_ptr<string>)"){
+        shared_ptr<string> p = make_shared<string>("1");
+        shared_ptr<string> q = make_shared<string>("2");
+        vector<shared_ptr<string>> v(5, p);
+        v = {q, q};
+        REQUIRE(p.use_count() == 1);
+        REQUIRE(q.use_count() == 3);
+        REQUIRE(v.size() == 2);
+        REQUIRE(v.capacity() == 5);
+        v = {};
+        REQUIRE(q.use_count() == 1);
+    }SECTION("Assign n copies (Buffer)"){
+        vector<Buffer> v{Buffer{1}, Buffer{2}, Buffer{3}};
+        v.assign(2, v[2]);
+        REQUIRE(v.size() == 2);
+        REQUIRE(v[0] == Buffer{3});
+        REQUIRE(v[1] == Buffer{3});
+        v.assign(3, v[0]);
+        REQUIRE(v.size() == 3);
+        REQUIRE(v.capacity() == 3);
+        v.assign(6, v[1]);
+        REQUIRE(v.size() == 6);
+        REQUIRE(v.capacity() == 6);
+        REQUIRE(v[5] == Buffer{3});
+        v.assign(0, Buffer{});
+        REQUIRE(v.empty());
+    }SECTION("Assign from iterators (int)"){
+        vector<int> v(8, 7);
+        std::array<int, 3> source{1, 2, 3};
+        v.assign(source.begin(), source.end());
+        REQUIRE(std::ranges::equal(v, source));
+        REQUIRE(v.capacity() == 8);
+        std::istringstream stream("4 5 6 7 8 9 10 11 12 13");
+        v.assign(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+        REQUIRE(v.size() == 10);
+        REQUIRE(v[0] == 4);
+        REQUIRE(v[9] == 13);
+        std::list<int> list{1, 2};
+        v.assign_range(list);
+        REQUIRE(std::ranges::equal(v, list));
+        REQUIRE(v.capacity() >= 10);
+    }SECTION("Element counts (Counted)"){
+        {
+            vector<Counted> v;
+            for (int i = 0; i < 6; i++){
+                v.emplace_back(i);
+            }
+            vector<Counted> small;
+            small.emplace_back(42);
+            v = small;
+            REQUIRE(Counted::alive == 2);
+            REQUIRE(v[0].value == 42);
+            v.assign(4, Counted{5});
+            REQUIRE(Counted::alive == 5);
+            Counted::copiesLeft = 2;
+            REQUIRE_THROWS_AS(v.assign(6, Counted{1}), std::runtime_error);
+            Counted::copiesLeft = -1;
+            REQUIRE(v.size() == 4);
+            REQUIRE(Counted::alive == 5);
+        }
+        REQUIRE(Counted::alive == 0);
+    }
+}
+
+TEST_CASE("Copy-on-write vector"){
+    static_assert(std::random_access_iterator<MyVec::cow_vector<int>::iterator>);
+    static_assert(std::ranges::random_access_range<MyVec::cow_slice<int>>);
+    SECTION("Snapshots share storage until written (string)"){
+        MyVec::cow_vector<string> v{"1", "2", "3"};
+        MyVec::cow_vector<string> snapshot = v.snapshot();
+        REQUIRE(snapshot.data() == v.data());
+        REQUIRE(v.use_count() == 2);
+        REQUIRE_FALSE(v.unique());
+        v.push_back("4");
+        REQUIRE(v.unique());
+        REQUIRE(snapshot.unique());
+        REQUIRE(v.size() == 4);
+        REQUIRE(snapshot.size() == 3);
+        REQUIRE(snapshot.data() != v.data());
+        const string *before = v.data();
+        v.set(0, "0");
+        REQUIRE(v.data() == before);
+        REQUIRE(v[0] == "0");
+        REQUIRE(snapshot[0] == "1");
+        REQUIRE_THROWS_AS(v.at(4), std::out_of_range);
+    }SECTION("Slices keep the block alive (int)"){
+        MyVec::vector<int> source(1000, 0);
+        std::iota(source.begin(), source.end(), 0);
+        MyVec::cow_slice<int> tail;
+        {
+            MyVec::cow_vector<int> v(std::move(source));
+            tail = v.slice(900, 1000);
+            REQUIRE(tail.data() == v.data() + 900);
+            REQUIRE(v.use_count() == 2);
+            v.write()[950] = -1;
+            REQUIRE(v[950] == -1);
+            REQUIRE_THROWS_AS(v.slice(10, 1001), std::out_of_range);
+        }
+        REQUIRE(tail.size() == 100);
+        REQUIRE(tail[50] == 950);
+        REQUIRE(tail.span().back() == 999);
+        auto middle = tail.subslice(10, 20);
+        REQUIRE(std::accumulate(middle.begin(), middle.end(), 0) == 9145);
+        REQUIRE(middle.at(9) == 919);
+        REQUIRE_THROWS_AS(middle.at(10), std::out_of_range);
+    }SECTION("Elements are copied only on clone (shared_ptr<string>)"){
+        shared_ptr<string> p = make_shared<string>("1");
+        MyVec::cow_vector<shared_ptr<string>> v;
+        REQUIRE(v.empty());
+        REQUIRE(v.begin() == v.end());
+        for (int i = 0; i < 100; i++){
+            v.push_back(p);
+        }
+        std::vector<MyVec::cow_vector<shared_ptr<string>>> snapshots(64, v);
+        REQUIRE(p.use_count() == 101);
+        REQUIRE(v.use_count() == 65);
+        v.pop_back();
+        REQUIRE(p.use_count() == 200);
+        snapshots.clear();
+        REQUIRE(p.use_count() == 100);
+        v.clear();
+        REQUIRE(p.use_count() == 1);
+    }SECTION("Readers on other threads (Buffer)"){
+        MyVec::cow_vector<Buffer> v;
+        for (int i = 0; i < 1000; i++){
+            v.emplace_back(i % 3 + 1);
+        }
+        std::atomic<int> errors{0};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; t++){
+            readers.emplace_back([snapshot = v.snapshot(), &errors]{
+                for (int round = 0; round < 10; round++){
+                    for (std::size_t i = 0; i < snapshot.size(); i++){
+                        if (!(snapshot[i] == Buffer(static_cast<int>(i % 3 + 1)))){
+                            errors++;
+                        }
+                    }
+                }
+            });
+        }
+        for (int i = 0; i < 1000; i++){
+            v.set(i, Buffer{1});
+        }
+        for (auto &reader: readers){
+            reader.join();
+        }
+        REQUIRE(errors == 0);
+        REQUIRE(v.unique());
+        REQUIRE(v[999] == Buffer{1});
+    }
+}
+
+TEST_CASE("Persistent vector"){
+    static_assert(std::random_access_iterator<MyVec::persistent_vector<int>::iterator>);
+    SECTION("Versions share unchanged nodes (int)"){
+        MyVec::persistent_vector<int> v;
+        for (int i = 0; i < 5000; i++){
+            v = v.push_back(i);
+        }
+        REQUIRE(v.size() == 5000);
+        REQUIRE(std::accumulate(v.begin(), v.end(), 0LL) == 4999LL * 5000 / 2);
+        std::vector<MyVec::persistent_vector<int>> versions{v};
+        for (int i = 0; i < 1000; i++){
+            versions.push_back(versions.back().set(i * 5, -i));
+        }
+        REQUIRE(v[5] == 5);
+        REQUIRE(versions[1000][5] == -1);
+        REQUIRE(versions[1][5] == 5);
+        REQUIRE(versions[1000][4995] == -999);
+        REQUIRE(&versions[1][4999] == &v[4999]);
+        REQUIRE(&versions[1000][4999] != &v[4999]);
+        REQUIRE(versions[501].at(2500) == -500);
+        REQUIRE(versions[500].at(2500) == 2500);
+        REQUIRE_THROWS_AS(v.at(5000), std::out_of_range);
+        REQUIRE_THROWS_AS(v.set(5000, 0), std::out_of_range);
+    }SECTION("Slice and concat (int)"){
+        MyVec::persistent_vector<int> v;
+        for (int i = 0; i < 40000; i++){
+            v = v.push_back(i);
+        }
+        auto middle = v.slice(1000, 39000);
+        REQUIRE(middle.size() == 38000);
+        REQUIRE(middle.front() == 1000);
+        REQUIRE(middle.back() == 38999);
+        REQUIRE(middle[12345] == 13345);
+        auto joined = v.slice(0, 1000).concat(middle).concat(v.slice(39000, 40000));
+        REQUIRE(joined.size() == 40000);
+        REQUIRE(std::equal(joined.begin(), joined.end(), v.begin()));
+        MyVec::persistent_vector<int> pieces;
+        for (int i = 0; i < 3000; i += 7){
+            pieces = pieces.concat(v.slice(i, i + 7));
+        }
+        REQUIRE(pieces.size() == 3003);
+        for (int i = 0; i < 3003; i++){
+            REQUIRE(pieces[i] == i);
+        }
+        auto grown = pieces.push_back(-1).set(3, -3);
+        REQUIRE(grown.size() == 3004);
+        REQUIRE(grown[3003] == -1);
+        REQUIRE(grown[3] == -3);
+        REQUIRE(pieces[3] == 3);
+        REQUIRE(v.slice(5, 5).empty());
+        REQUIRE(v.pop_back().size() == 39999);
+        REQUIRE_THROWS_AS(v.slice(2, 1), std::out_of_range);
+    }SECTION("Transient batch edits (string)"){
+        MyVec::persistent_vector<string> base{"a", "b", "c"};
+        auto builder = base.transient();
+        for (int i = 0; i < 2000; i++){
+            builder.push_back(std::to_string(i));
+        }
+        builder.set(0, "z");
+        REQUIRE(builder.size() == 2003);
+        REQUIRE(builder[2002] == "1999");
+        auto edited = std::move(builder).persistent();
+        REQUIRE(builder.size() == 0);
+        REQUIRE(base.size() == 3);
+        REQUIRE(base[0] == "a");
+        REQUIRE(edited[0] == "z");
+        REQUIRE(edited[3] == "0");
+        auto reversed = edited;
+        std::vector<string> copy(edited.begin(), edited.end());
+        REQUIRE(copy.size() == 2003);
+        REQUIRE(std::equal(copy.rbegin(), copy.rend(), std::make_reverse_iterator(reversed.end())));
+    }SECTION("Element lifetimes (shared_ptr<string>)"){
+        shared_ptr<string> p = make_shared<string>("1");
+        {
+            MyVec::persistent_vector<shared_ptr<string>> v;
+            for (int i = 0; i < 100; i++){
+                v = v.push_back(p);
+            }
+            REQUIRE(p.use_count() == 101);
+            auto v2 = v.set(99, nullptr);
+            REQUIRE(p.use_count() == 100 + 4);
+            auto v3 = v.slice(10, 90).concat(v2);
+            REQUIRE(v3.size() == 180);
+            v = {};
+            v2 = {};
+            REQUIRE(std::count(v3.begin(), v3.end(), p) == 179);
+        }
+        REQUIRE(p.use_count() == 1);
+    }SECTION("Buffer elements"){
+        MyVec::persistent_vector<Buffer> v{Buffer{1}, Buffer{2}};
+        auto v2 = v.push_back(Buffer{3}).concat(v);
+        REQUIRE(v2.size() == 5);
+        REQUIRE(v2[2] == Buffer{3});
+        REQUIRE(v2[4] == Buffer{2});
+    }
+}
+
+/// Таблица, построенная вектором на этапе компиляции
+constexpr std::array<int, 10> squares_table(){
+    vector<int> v;
+    for (int i = 0; i < 10; i++){
+        v.push_back(i * i);
+    }
+    std::array<int, 10> table{};
+    std::copy(v.begin(), v.end(), table.begin());
+    return table;
+}
+
+constexpr bool constant_evaluated_operations(){
+    vector<int> v{5, 1, 4};
+    v.reserve(16);
+    v.emplace_back(2);
+    v.insert(v.begin() + 1, 9);
+    v.insert(v.begin(), v[2]);
+    v.erase(v.begin() + 3);
+    int expected[] = {1, 5, 9, 4, 2};
+    if (!std::ranges::equal(v, expected)){
+        return false;
+    }
+
+    vector<int> copy = v;
+    copy.erase(copy.begin(), copy.begin() + 2);
+    copy.unordered_erase(copy.begin());
+    if (copy.size() != 2 || copy[0] != 2 || copy[1] != 4 || copy.swap_remove(0) != 2){
+        return false;
+    }
+
+    MyVec::erase_if(v, [](int x){ return x % 2 == 0; });
+    v.assign(3, v[1]);
+    vector<int> moved = std::move(v);
+    return moved.size() == 3 && moved.at(2) == 5 && v.empty();
+}
+
+constexpr std::size_t constant_evaluated_strings(){
+    vector<std::string> v;
+    for (int i = 0; i < 20; i++){
+        v.emplace_back(i, 'a');
+    }
+    v.insert(v.begin() + 3, std::string("inserted"));
+    v.erase(v.begin(), v.begin() + 2);
+    v.retain([](const std::string &s){ return s.size() % 3 != 0; });
+    std::size_t total = 0;
+    for (const std::string &s: v){
+        total += s.size();
+    }
+    return total + v.size();
+}
+
+TEST_CASE("Constant evaluation"){
+    constexpr std::array<int, 10> table = squares_table();
+    static_assert(table[0] == 0 && table[9] == 81);
+    static_assert(constant_evaluated_operations());
+    // Остаются строки длиной 2, 8 ("inserted") и 4..19, кроме кратных 3: 134 символа в 13 строках
+    static_assert(constant_evaluated_strings() == 134 + 13);
+
+    // Во время выполнения те же функции идут через memcpy/memmove
+    REQUIRE(squares_table() == table);
+    REQUIRE(constant_evaluated_operations());
+    REQUIRE(constant_evaluated_strings() == 134 + 13);
+}
+
+static_assert(std::is_trivially_copyable_v<MyVec::inplace_vector<int, 16>>);
+static_assert(!std::is_trivially_copyable_v<MyVec::inplace_vector<string, 16>>);
+static_assert(std::random_access_iterator<MyVec::inplace_vector<string, 4>::iterator>);
+
+TEST_CASE("Inplace vector (string)"){
+    using MyVec::inplace_vector;
+    SECTION("Constructors"){
+        SECTION("By size and value"){
+            inplace_vector<string, 4> v(3, "Always has been...");
+            REQUIRE(v.size() == 3);
+            REQUIRE(v[2] == "Always has been...");
+            REQUIRE_THROWS_AS((inplace_vector<string, 4>(5, "1")), std::bad_alloc);
+        }SECTION("By range"){
+            std::list<string> source{"1", "2", "3"};
+            inplace_vector<string, 4> v(source.begin(), source.end());
+            REQUIRE(std::ranges::equal(v, source));
+            std::istringstream in("4 5 6 7 8");
+            REQUIRE_THROWS_AS((inplace_vector<string, 4>(std::istream_iterator<string>(in),
+                                                         std::istream_iterator<string>())), std::bad_alloc);
+        }SECTION("Copy and move"){
+            inplace_vector<string, 4> v{"Wait, placement new is an answer?", "Always has been..."};
+            inplace_vector<string, 4> v2{v};
+            REQUIRE(std::ranges::equal(v, v2));
+            inplace_vector<string, 4> v3{std::move(v2)};
+            REQUIRE(v3[1] == "Always has been...");
+        }
+    }
+
+    SECTION("Operators"){
+        SECTION("= - Copy"){
+            inplace_vector<string, 4> v{"1", "2", "3"};
+            inplace_vector<string, 4> v2{"4"};
+            v2 = v;
+            REQUIRE(std::ranges::equal(v, v2));
+            v = {"5"};
+            v2 = v;
+            REQUIRE(v2.size() == 1);
+            REQUIRE(v2[0] == "5");
+        }SECTION("= - Init list"){
+            inplace_vector<string, 2> v{};
+            REQUIRE_THROWS_AS((v = {"1", "2", "3"}), std::bad_alloc);
+            REQUIRE(v.empty());
+        }
+    }
+
+    SECTION("Methods"){
+        SECTION("Push back variants"){
+            inplace_vector<string, 3> v{};
+            v.push_back("1");
+            v.emplace_back(2, '2');
+            REQUIRE(*v.try_push_back("3") == "3");
+            string rejected = "4";
+            REQUIRE(v.try_push_back(std::move(rejected)) == nullptr);
+            REQUIRE(rejected == "4");
+            REQUIRE_THROWS_AS(v.push_back("4"), std::bad_alloc);
+            v.pop_back();
+            REQUIRE(v.unchecked_push_back("5") == "5");
+            REQUIRE(std::ranges::equal(v, std::vector<string>{"1", "22", "5"}));
+        }SECTION("At"){
+            inplace_vector<string, 3> v{"1"};
+            REQUIRE(v.at(0) == "1");
+            REQUIRE_THROWS_AS(v.at(1), std::out_of_range);
+        }SECTION("Insert and erase"){
+            inplace_vector<string, 8> v{"1", "2", "3"};
+            v.insert(v.begin(), v[2]);
+            v.emplace(v.begin() + 2, 3, 'x');
+            v.insert(v.end(), 2, v[0]);
+            REQUIRE(std::ranges::equal(v, std::vector<string>{"3", "1", "xxx", "2", "3", "3", "3"}));
+            std::vector<string> tail{"a", "b"};
+            REQUIRE_THROWS_AS(v.insert(v.begin(), tail.begin(), tail.end()), std::bad_alloc);
+            REQUIRE(v.size() == 7);
+            v.erase(v.begin() + 4, v.end());
+            v.erase(v.begin());
+            v.insert(v.begin() + 1, tail.begin(), tail.end());
+            REQUIRE(std::ranges::equal(v, std::vector<string>{"1", "a", "b", "xxx", "2"}));
+        }SECTION("Resize and assign"){
+            inplace_vector<string, 4> v{"1"};
+            v.resize(3, v[0]);
+            REQUIRE(std::ranges::equal(v, std::vector<string>{"1", "1", "1"}));
+            v.resize(1);
+            v.assign(4, v[0]);
+            REQUIRE(v.size() == 4);
+            REQUIRE_THROWS_AS(v.resize(5), std::bad_alloc);
+            REQUIRE_THROWS_AS(v.reserve(5), std::bad_alloc);
+            REQUIRE(v.capacity() == 4);
+        }
+    }
+}
+
+TEST_CASE("Inplace vector (Buffer)"){
+    using MyVec::inplace_vector;
+    SECTION("Element lifetimes"){
+        inplace_vector<Buffer, 4> v{Buffer{1}, Buffer{2}, Buffer{3}};
+        v.insert(v.begin() + 1, Buffer{4});
+        v.erase(v.begin());
+        REQUIRE(std::ranges::equal(v, std::vector<Buffer>{Buffer{4}, Buffer{2}, Buffer{3}}));
+        inplace_vector<Buffer, 4> v2{Buffer{5}};
+        v.swap(v2);
+        REQUIRE(v.size() == 1);
+        REQUIRE(v2.size() == 3);
+        REQUIRE(v2[2] == Buffer{3});
+        v2 = v;
+        REQUIRE(v2.size() == 1);
+        REQUIRE(v2[0] == Buffer{5});
+    }SECTION("Storage is inline"){
+        inplace_vector<Buffer, 4> v{Buffer{1}};
+        auto *first = reinterpret_cast<const std::byte *>(&v);
+        auto *element = reinterpret_cast<const std::byte *>(v.data());
+        REQUIRE(element >= first);
+        REQUIRE(element < first + sizeof(v));
+    }
+}
+
+TEST_CASE("Inplace vector (shared_ptr<string>)"){
+    using MyVec::inplace_vector;
+    shared_ptr<string> p = make_shared<string>("1");
+    {
+        inplace_vector<shared_ptr<string>, 8> v(5, p);
+        REQUIRE(p.use_count() == 6);
+        v.erase(v.begin() + 1, v.begin() + 3);
+        REQUIRE(p.use_count() == 4);
+        inplace_vector<shared_ptr<string>, 8> v2{v};
+        REQUIRE(p.use_count() == 7);
+        v2.emplace(v2.begin(), make_shared<string>("2"));
+        REQUIRE(*v2[0] == "2");
+        inplace_vector<shared_ptr<string>, 8> v3{std::move(v2)};
+        REQUIRE(p.use_count() == 7);
+        v3.clear();
+        REQUIRE(p.use_count() == 4);
+    }
+    REQUIRE(p.use_count() == 1);
+}
+
+TEST_CASE("Inplace vector (trivially copyable)"){
+    MyVec::inplace_vector<int, 16> v{1, 2, 3};
+    MyVec::inplace_vector<int, 16> copy;
+    std::memcpy(static_cast<void *>(&copy), &v, sizeof(v));
+    REQUIRE(std::ranges::equal(copy, v));
+    REQUIRE(copy.try_push_back(4) != nullptr);
+    REQUIRE(copy.size() == 4);
+}
+
+TEST_CASE("Flat map"){
+    using MyVec::flat_map;
+    SECTION("Constructors"){
+        SECTION("Init list keeps first duplicate"){
+            flat_map<string, int> m{{"b", 2}, {"a", 1}, {"b", 3}};
+            REQUIRE(m.size() == 2);
+            REQUIRE(std::ranges::equal(m.keys(), std::vector<string>{"a", "b"}));
+            REQUIRE(std::ranges::equal(m.values(), std::vector<int>{1, 2}));
+        }SECTION("By range"){
+            std::map<int, string> source{{3, "3"}, {1, "1"}, {2, "2"}};
+            flat_map<int, string> m(source.begin(), source.end());
+            REQUIRE(std::ranges::equal(m.keys(), std::vector<int>{1, 2, 3}));
+            REQUIRE(m.at(2) == "2");
+        }
+    }
+
+    SECTION("Methods"){
+        SECTION("Lookup"){
+            flat_map<int, string> m{{10, "10"}, {20, "20"}, {30, "30"}};
+            REQUIRE(get<1>(*m.find(20)) == "20");
+            REQUIRE(m.find(25) == m.end());
+            REQUIRE(m.lower_bound(20) - m.begin() == 1);
+            REQUIRE(m.upper_bound(20) - m.begin() == 2);
+            REQUIRE(m.lower_bound(5) == m.begin());
+            REQUIRE(m.upper_bound(30) == m.end());
+            REQUIRE(m.contains(30));
+            REQUIRE(m.count(31) == 0);
+            REQUIRE_THROWS_AS(m.at(31), std::out_of_range);
+            const flat_map<int, string> &constant = m;
+            REQUIRE(constant.at(10) == "10");
+            REQUIRE(constant.find(40) == constant.end());
+        }SECTION("Heterogeneous lookup"){
+            flat_map<string, int, std::less<>> m{{"alpha", 1}, {"beta", 2}};
+            REQUIRE(m.contains(std::string_view("beta")));
+            REQUIRE(m.find("alpha") == m.begin());
+            REQUIRE(m.lower_bound("b") - m.begin() == 1);
+        }SECTION("Single insert"){
+            flat_map<string, int> m;
+            REQUIRE(m.insert({"b", 2}).second);
+            REQUIRE_FALSE(m.insert({"b", 5}).second);
+            REQUIRE(m.try_emplace("a", 1).second);
+            m["c"] = 3;
+            m["a"] += 10;
+            REQUIRE_FALSE(m.insert_or_assign("b", 20).second);
+            REQUIRE(m.insert_or_assign("d", 4).second);
+            REQUIRE(std::ranges::equal(m.keys(), std::vector<string>{"a", "b", "c", "d"}));
+            REQUIRE(std::ranges::equal(m.values(), std::vector<int>{11, 20, 3, 4}));
+        }SECTION("Iteration"){
+            flat_map<string, int> m{{"b", 2}, {"a", 1}};
+            for (auto [key, value] : m){
+                value *= 10;
+            }
+            REQUIRE(std::ranges::equal(m.values(), std::vector<int>{10, 20}));
+            REQUIRE(std::is_sorted(m.keys().begin(), m.keys().end()));
+        }SECTION("Bulk insert"){
+            flat_map<int, int> m{{4, 40}, {8, 80}};
+            std::vector<std::pair<int, int>> tail{{6, 60}, {4, 0}, {1, 10}, {9, 90}, {6, 0}, {1, 0}};
+            m.insert(tail.begin(), tail.end());
+            REQUIRE(std::ranges::equal(m.keys(), std::vector<int>{1, 4, 6, 8, 9}));
+            REQUIRE(std::ranges::equal(m.values(), std::vector<int>{10, 40, 60, 80, 90}));
+            m.insert({{10, 100}, {11, 110}});
+            REQUIRE(m.size() == 7);
+            REQUIRE(m.at(11) == 110);
+        }SECTION("Bulk insert matches std::map"){
+            flat_map<int, int> m;
+            std::map<int, int> expected;
+            unsigned state = 1;
+            for (int round = 0; round < 20; round++){
+                std::vector<std::pair<int, int>> batch;
+                for (int i = 0; i < 500; i++){
+                    state = state * 1103515245 + 12345;
+                    batch.emplace_back(static_cast<int>(state >> 16) % 5000, round);
+                }
+                m.insert(batch.begin(), batch.end());
+                expected.insert(batch.begin(), batch.end());
+            }
+            REQUIRE(m.size() == expected.size());
+            REQUIRE(std::ranges::equal(m.keys(), expected | std::views::keys));
+            REQUIRE(std::ranges::equal(m.values(), expected | std::views::values));
+        }SECTION("Erase"){
+            flat_map<string, Buffer> m;
+            m.try_emplace("a", 1);
+            m.try_emplace("b", 2);
+            m.try_emplace("c", 3);
+            REQUIRE(m.erase("b") == 1);
+            REQUIRE(m.erase("b") == 0);
+            auto it = m.erase(m.begin());
+            REQUIRE(get<0>(*it) == "c");
+            REQUIRE(get<1>(*it) == Buffer{3});
+            REQUIRE(m.size() == 1);
+        }SECTION("Bulk insert clears on exception"){
+            Counted::alive = 0;
+            {
+                flat_map<int, Counted> m;
+                m.try_emplace(1, 1);
+                std::vector<std::pair<int, Counted>> tail(5);
+                Counted::copiesLeft = 3;
+                REQUIRE_THROWS_AS(m.insert(tail.begin(), tail.end()), std::runtime_error);
+                Counted::copiesLeft = -1;
+                REQUIRE(m.empty());
+                REQUIRE(Counted::alive == 5);
+            }
+            REQUIRE(Counted::alive == 0);
+        }
+    }
+}
+
+TEST_CASE("Flat set"){
+    using MyVec::flat_set;
+    SECTION("Insert and lookup"){
+        flat_set<string> s{"c", "a", "c"};
+        REQUIRE(s.insert("b").second);
+        REQUIRE_FALSE(s.insert("a").second);
+        REQUIRE(*s.emplace(2, 'd').first == "dd");
+        REQUIRE(std::ranges::equal(s, std::vector<string>{"a", "b", "c", "dd"}));
+        REQUIRE(s.lower_bound("bb") - s.begin() == 2);
+        REQUIRE(s.upper_bound("c") - s.begin() == 3);
+        REQUIRE(s.find("e") == s.end());
+    }SECTION("Heterogeneous lookup"){
+        flat_set<string, std::less<>> s{"alpha", "beta"};
+        REQUIRE(s.contains(std::string_view("alpha")));
+        REQUIRE(s.count("gamma") == 0);
+    }SECTION("Bulk insert"){
+        flat_set<int> s{5, 1, 9};
+        std::list<int> tail{7, 5, 3, 7, 0, 9, 11};
+        s.insert(tail.begin(), tail.end());
+        REQUIRE(std::ranges::equal(s, std::vector<int>{0, 1, 3, 5, 7, 9, 11}));
+        std::istringstream in("4 2 4");
+        s.insert(std::istream_iterator<int>(in), std::istream_iterator<int>());
+        REQUIRE(std::ranges::equal(s, std::vector<int>{0, 1, 2, 3, 4, 5, 7, 9, 11}));
+    }SECTION("Erase"){
+        flat_set<int> s{1, 2, 3};
+        REQUIRE(s.erase(2) == 1);
+        REQUIRE(*s.erase(s.begin()) == 3);
+        REQUIRE(s.size() == 1);
+    }
+}
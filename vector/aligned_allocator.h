@@ -0,0 +1,84 @@
+#ifndef MYVEC_ALIGNED_ALLOCATOR_H
+#define MYVEC_ALIGNED_ALLOCATOR_H
+
+#include <algorithm>
+#include <bit>
+#include <new>
+#include <sys/mman.h>
+#include "vector.h"
+
+namespace MyVec {
+    /// Аллокатор с выравниванием блоков по Alignment байт (например, 64 - строка кэша и ширина AVX-512).
+    /// Блоки от HugePageThreshold байт выравниваются и округляются до 2 МБ и помечаются madvise(MADV_HUGEPAGE),
+    /// чтобы ядро отображало их прозрачными большими страницами
+    /// \tparam T Тип хранимых значений
+    /// \tparam Alignment Выравнивание блоков в байтах
+    /// \tparam HugePageThreshold Размер блока в байтах, начиная с которого используются большие страницы, 0 - никогда
+    template <typename T, std::size_t Alignment = 64, std::size_t HugePageThreshold = std::size_t{2} << 20>
+    class aligned_allocator {
+        static_assert(std::has_single_bit(Alignment), "Alignment must be a power of two");
+    public:
+        /// Тип хранимых значений
+        using value_type = T;
+
+        template <typename U>
+        struct rebind {
+            using other = aligned_allocator<U, Alignment, HugePageThreshold>;
+        };
+
+        /// Фактическое выравнивание блоков
+        static constexpr std::size_t alignment = std::max(Alignment, alignof(T));
+
+        /// Размер прозрачной большой страницы
+        static constexpr std::size_t huge_page_size = std::size_t{2} << 20;
+
+        aligned_allocator() noexcept = default;
+
+        /// Конструктор из аллокатора другого типа (для rebind)
+        template <typename U>
+        aligned_allocator(const aligned_allocator<U, Alignment, HugePageThreshold> &) noexcept{}
+
+        /// Выделяет память под n элементов
+        /// \param n Количество элементов
+        /// \return Указатель на выделенную память
+        [[nodiscard]] T *allocate(std::size_t n){
+            if (n > std::size_t(-1) / sizeof(T)){
+                throw std::bad_array_new_length();
+            }
+            std::size_t bytes = n * sizeof(T);
+            if (!is_huge(bytes)){
+                return static_cast<T *>(::operator new(bytes, std::align_val_t{alignment}));
+            }
+            std::size_t rounded = huge_round(bytes);
+            void *p = ::operator new(rounded, std::align_val_t{huge_page_size});
+            // Подсказка: без поддержки THP блок остаётся на обычных страницах
+            ::madvise(p, rounded, MADV_HUGEPAGE);
+            return static_cast<T *>(p);
+        }
+
+        /// Освобождает память
+        /// \param p Указатель на память
+        /// \param n Количество элементов, под которое выделялась память
+        void deallocate(T *p, std::size_t n) noexcept{
+            std::size_t bytes = n * sizeof(T);
+            if (is_huge(bytes)){
+                ::operator delete(p, huge_round(bytes), std::align_val_t{huge_page_size});
+            } else {
+                ::operator delete(p, bytes, std::align_val_t{alignment});
+            }
+        }
+
+        template <typename U>
+        bool operator==(const aligned_allocator<U, Alignment, HugePageThreshold> &) const noexcept{ return true; }
+    private:
+        static constexpr bool is_huge(std::size_t bytes) noexcept{
+            return HugePageThreshold && bytes >= HugePageThreshold;
+        }
+
+        static constexpr std::size_t huge_round(std::size_t bytes) noexcept{
+            return (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,465 @@
+#ifndef MYVEC_CONCURRENT_VECTOR_H
+#define MYVEC_CONCURRENT_VECTOR_H
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <new>
+#include "vector.h"
+
+namespace MyVec {
+    template <typename T>
+    class concurrent_vector;
+
+    /// Итератор concurrent_vector: индекс элемента, разыменование находит сегмент
+    /// \tparam T адресуемый итератором тип
+    /// \tparam is_const итератор является const_iterator если true, обычным iterator в ином случае
+    template <typename T, bool is_const>
+    class ConcurrentIterator {
+    private:
+        using container = std::conditional_t<is_const, const concurrent_vector<T>, concurrent_vector<T>>;
+
+        container *owner = nullptr;
+        std::ptrdiff_t index = 0;
+    public:
+        /// Категория итератора
+        using iterator_category = std::random_access_iterator_tag;
+
+        /// Адресуемый итератором тип
+        using value_type = T;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Тип указателя на хранимое значение, для const_iterator - const T*, для обычного - T*
+        using pointer = std::conditional_t<is_const, const T *, T *>;
+
+        /// Тип ссылки на хранимое значение, для const_iterator - const T&, для обычного - T&
+        using reference = std::conditional_t<is_const, const T &, T &>;
+
+        /// Пустой конструктор
+        ConcurrentIterator() noexcept = default;
+
+        /// Конструктор по вектору и индексу
+        /// \param owner Вектор
+        /// \param index Индекс элемента
+        ConcurrentIterator(container *owner, std::ptrdiff_t index) noexcept: owner{owner}, index{index}{}
+
+        /// Преобразование iterator в const_iterator
+        /// \param other Неконстантный итератор
+        template <bool other_const>
+        ConcurrentIterator(const ConcurrentIterator<T, other_const> &other) noexcept requires (is_const && !other_const)
+                : owner{other.owner}, index{other.index}{}
+
+        reference operator*() const noexcept{ return (*owner)[static_cast<std::size_t>(index)]; }
+
+        pointer operator->() const noexcept{ return &**this; }
+
+        reference operator[](difference_type n) const noexcept{ return (*owner)[static_cast<std::size_t>(index + n)]; }
+
+        ConcurrentIterator &operator++() noexcept{
+            ++index;
+            return *this;
+        }
+
+        ConcurrentIterator operator++(int) noexcept{
+            ConcurrentIterator tmp = *this;
+            ++index;
+            return tmp;
+        }
+
+        ConcurrentIterator &operator--() noexcept{
+            --index;
+            return *this;
+        }
+
+        ConcurrentIterator operator--(int) noexcept{
+            ConcurrentIterator tmp = *this;
+            --index;
+            return tmp;
+        }
+
+        ConcurrentIterator &operator+=(difference_type n) noexcept{
+            index += n;
+            return *this;
+        }
+
+        ConcurrentIterator &operator-=(difference_type n) noexcept{
+            index -= n;
+            return *this;
+        }
+
+        friend ConcurrentIterator operator+(ConcurrentIterator it, difference_type n) noexcept{ return it += n; }
+
+        friend ConcurrentIterator operator+(difference_type n, ConcurrentIterator it) noexcept{ return it += n; }
+
+        friend ConcurrentIterator operator-(ConcurrentIterator it, difference_type n) noexcept{ return it -= n; }
+
+        friend difference_type operator-(const ConcurrentIterator &a, const ConcurrentIterator &b) noexcept{
+            return a.index - b.index;
+        }
+
+        bool operator==(const ConcurrentIterator &other) const noexcept{ return index == other.index; }
+
+        auto operator<=>(const ConcurrentIterator &other) const noexcept{ return index <=> other.index; }
+
+        friend class ConcurrentIterator<T, !is_const>;
+    };
+
+    /// Вектор с параллельным добавлением из нескольких потоков. Элементы хранятся в сегментах, размеры которых
+    /// удваиваются, и никогда не переносятся, поэтому адреса элементов стабильны.
+    /// push_back/emplace_back/grow_by захватывают индексы одним fetch_add и не ждут других потоков
+    /// (кроме выделения памяти под новый сегмент): публикация помогает лишь индексам, захваченным до её начала.
+    /// size() - опубликованный размер: все элементы до него сконструированы и могут читаться параллельно
+    /// с добавлением. Исключение: если конструирование бросило
+    /// исключение, а у T нет noexcept конструктора по умолчанию, ячейка остаётся пустой, но тоже публикуется,
+    /// чтобы не останавливать последующие добавления; такие индексы отсекает constructed()
+    /// \tparam T Тип хранимых значений
+    template <typename T>
+    class concurrent_vector {
+    public:
+        /// Тип итератора
+        using iterator = ConcurrentIterator<T, false>;
+
+        /// Тип константного итератора
+        using const_iterator = ConcurrentIterator<T, true>;
+
+        /// Тип хранимых значений
+        using value_type = T;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Ссылка на тип хранимых значений
+        using reference = T &;
+
+        /// Константная ссылка на тип хранимых значений
+        using const_reference = const T &;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+
+        /// Ёмкость первого сегмента; сегмент k вмещает first_segment * 2^k элементов
+        static constexpr size_type first_segment = std::bit_floor(std::max<size_type>(8, 4096 / sizeof(T)));
+    private:
+        static constexpr int first_shift = std::countr_zero(first_segment);
+        static constexpr size_type max_segments = 64 - first_shift;
+
+        /// Состояние ячейки: ещё конструируется, сконструирована, пуста после исключения (публикуется без элемента)
+        enum state : std::uint8_t { pending = 0, filled = 1, failed = 2 };
+
+        /// Блок сегмента: флаги состояния элементов, затем сами элементы
+        struct segment {
+            std::atomic<std::byte *> block{nullptr};
+        };
+
+        std::array<segment, max_segments> segments{};
+        std::atomic<size_type> claimed{0};
+        std::atomic<size_type> published{0};
+
+        static constexpr size_type segment_of(size_type index) noexcept{
+            return std::bit_width(index + first_segment) - 1 - first_shift;
+        }
+        static constexpr size_type segment_start(size_type k) noexcept{ return (first_segment << k) - first_segment; }
+        static constexpr size_type segment_capacity(size_type k) noexcept{ return first_segment << k; }
+        static constexpr size_type flags_bytes(size_type k) noexcept{
+            return (segment_capacity(k) + alignof(T) - 1) / alignof(T) * alignof(T);
+        }
+        static constexpr std::size_t block_alignment = std::max(alignof(T), alignof(std::atomic<std::uint8_t>));
+
+        std::byte *ensure_segment(size_type k);
+        void ensure_range(size_type first, size_type n);
+        std::atomic<std::uint8_t> &ready(size_type index) const noexcept;
+        bool is_settled(size_type index) const noexcept;
+        T *slot(size_type index) const noexcept;
+        template <typename Construct>
+        void construct_range(size_type first, size_type n, Construct &&construct);
+        void abandon(size_type first, size_type last) noexcept;
+        void publish() noexcept;
+    public:
+        /// Пустой конструктор
+        concurrent_vector() noexcept = default;
+
+        concurrent_vector(const concurrent_vector &) = delete;
+        concurrent_vector &operator=(const concurrent_vector &) = delete;
+
+        /// Деструктор. Не должен выполняться параллельно с другими операциями
+        ~concurrent_vector();
+
+        /// Оператор доступа к элементу по индексу; индекс должен быть меньше size() или возвращён push_back
+        /// \param index Индекс элемента
+        /// \return Ссылка на элемент
+        [[nodiscard]] T &operator[](size_type index) noexcept{ return *slot(index); }
+
+        /// Оператор доступа к элементу по индексу (константная версия)
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент
+        [[nodiscard]] const T &operator[](size_type index) const noexcept{ return *slot(index); }
+
+        /// Возвращает ссылку на элемент с проверкой индекса по опубликованному размеру
+        /// \param index Индекс элемента
+        /// \return Ссылка на элемент
+        T &at(size_type index);
+
+        /// Возвращает ссылку на элемент с проверкой индекса по опубликованному размеру (константная версия)
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент
+        const T &at(size_type index) const;
+
+        /// Возвращает опубликованный размер: все элементы с меньшими индексами сконструированы,
+        /// кроме ячеек, оставшихся пустыми после исключения (см. constructed())
+        /// \return Размер вектора
+        [[nodiscard]] size_type size() const noexcept{ return published.load(std::memory_order_acquire); }
+
+        /// Проверяет, что по опубликованному индексу лежит элемент. false только для ячеек, конструирование
+        /// которых бросило исключение, если у T нет noexcept конструктора по умолчанию
+        /// \param index Индекс элемента
+        /// \return true, если элемент сконструирован и опубликован
+        [[nodiscard]] bool constructed(size_type index) const noexcept{
+            return index < size() && ready(index).load(std::memory_order_acquire) == filled;
+        }
+
+        /// Возвращает количество элементов в выделенных сегментах
+        /// \return Ёмкость вектора
+        [[nodiscard]] size_type capacity() const noexcept;
+
+        /// Проверяет, является ли вектор пустым
+        /// \return true, если опубликованный размер равен нулю
+        [[nodiscard]] bool empty() const noexcept{ return size() == 0; }
+
+        /// Заранее выделяет сегменты под n элементов
+        /// \param n Ёмкость
+        void reserve(size_type n);
+
+        /// Добавляет элемент в конец вектора
+        /// \param element Значение элемента
+        /// \return Индекс добавленного элемента
+        size_type push_back(const T &element) requires std::copy_constructible<T>{ return emplace_back(element); }
+
+        /// Добавляет элемент в конец вектора
+        /// \param element Значение элемента
+        /// \return Индекс добавленного элемента
+        size_type push_back(T &&element) requires std::move_constructible<T>{ return emplace_back(std::move(element)); }
+
+        /// Конструирует элемент в конце вектора. Если конструктор бросает исключение, ячейка заполняется T()
+        /// (для типов с noexcept конструктором по умолчанию), иначе остаётся пустой; в обоих случаях она
+        /// публикуется, и следующие элементы становятся видны
+        /// \param args Аргументы конструктора
+        /// \return Индекс добавленного элемента
+        template <typename ...Args>
+        size_type emplace_back(Args &&... args) requires std::constructible_from<T, Args...>;
+
+        /// Добавляет n элементов T() одним захватом диапазона. При исключении оставшиеся ячейки диапазона
+        /// обрабатываются как в emplace_back
+        /// \param n Количество элементов
+        /// \return Индекс первого добавленного элемента
+        size_type grow_by(size_type n) requires std::default_initializable<T>;
+
+        /// Добавляет n копий value одним захватом диапазона. При исключении оставшиеся ячейки диапазона
+        /// обрабатываются как в emplace_back
+        /// \param n Количество элементов
+        /// \param value Значение элементов
+        /// \return Индекс первого добавленного элемента
+        size_type grow_by(size_type n, const T &value) requires std::copy_constructible<T>;
+
+        /// Возвращает итератор на начало вектора
+        /// \return Итератор на начало
+        iterator begin() noexcept{ return iterator(this, 0); }
+
+        /// Возвращает итератор на конец опубликованной части вектора
+        /// \return Итератор на конец
+        iterator end() noexcept{ return iterator(this, static_cast<difference_type>(size())); }
+
+        /// Возвращает константный итератор на начало вектора
+        /// \return Константный итератор на начало
+        const_iterator begin() const noexcept{ return const_iterator(this, 0); }
+
+        /// Возвращает константный итератор на конец опубликованной части вектора
+        /// \return Константный итератор на конец
+        const_iterator end() const noexcept{ return const_iterator(this, static_cast<difference_type>(size())); }
+
+        /// Возвращает константный итератор на начало вектора
+        /// \return Константный итератор на начало
+        const_iterator cbegin() const noexcept{ return begin(); }
+
+        /// Возвращает константный итератор на конец опубликованной части вектора
+        /// \return Константный итератор на конец
+        const_iterator cend() const noexcept{ return end(); }
+    };
+}
+
+namespace MyVec {
+    template <typename T>
+    concurrent_vector<T>::~concurrent_vector(){
+        size_type total = claimed.load(std::memory_order_acquire);
+        for (size_type k = 0; k < max_segments; k++){
+            std::byte *block = segments[k].block.load(std::memory_order_acquire);
+            if (!block){
+                continue;
+            }
+            size_type start = segment_start(k);
+            for (size_type i = start; i < std::min(total, start + segment_capacity(k)); i++){
+                if (ready(i).load(std::memory_order_relaxed) == filled){
+                    std::destroy_at(slot(i));
+                }
+            }
+            ::operator delete(block, std::align_val_t{block_alignment});
+        }
+    }
+
+    template <typename T>
+    std::byte *concurrent_vector<T>::ensure_segment(size_type k){
+        std::byte *block = segments[k].block.load(std::memory_order_acquire);
+        if (block){
+            return block;
+        }
+        std::byte *fresh = static_cast<std::byte *>(::operator new(flags_bytes(k) + segment_capacity(k) * sizeof(T),
+                                                                    std::align_val_t{block_alignment}));
+        for (size_type i = 0; i < segment_capacity(k); i++){
+            new(fresh + i) std::atomic<std::uint8_t>(0);
+        }
+        // Сегмент могут выделять несколько потоков одновременно: остаётся первый установленный
+        if (segments[k].block.compare_exchange_strong(block, fresh, std::memory_order_acq_rel)){
+            return fresh;
+        }
+        ::operator delete(fresh, std::align_val_t{block_alignment});
+        return block;
+    }
+
+    template <typename T>
+    void concurrent_vector<T>::ensure_range(size_type first, size_type n){
+        if (n == 0){
+            return;
+        }
+        for (size_type k = segment_of(first); k <= segment_of(first + n - 1); k++){
+            ensure_segment(k);
+        }
+    }
+
+    template <typename T>
+    std::atomic<std::uint8_t> &concurrent_vector<T>::ready(size_type index) const noexcept{
+        size_type k = segment_of(index);
+        std::byte *block = segments[k].block.load(std::memory_order_acquire);
+        return *std::launder(reinterpret_cast<std::atomic<std::uint8_t> *>(block + (index - segment_start(k))));
+    }
+
+    template <typename T>
+    bool concurrent_vector<T>::is_settled(size_type index) const noexcept{
+        // Индекс может быть захвачен раньше, чем выделен его сегмент
+        return segments[segment_of(index)].block.load(std::memory_order_acquire)
+               && ready(index).load(std::memory_order_seq_cst) != pending;
+    }
+
+    template <typename T>
+    T *concurrent_vector<T>::slot(size_type index) const noexcept{
+        size_type k = segment_of(index);
+        std::byte *block = segments[k].block.load(std::memory_order_acquire);
+        return std::launder(reinterpret_cast<T *>(block + flags_bytes(k)) + (index - segment_start(k)));
+    }
+
+    template <typename T>
+    template <typename Construct>
+    void concurrent_vector<T>::construct_range(size_type first, size_type n, Construct &&construct){
+        size_type i = first;
+        try {
+            ensure_range(first, n);
+            for (; i < first + n; i++){
+                construct(slot(i));
+                ready(i).store(filled, std::memory_order_seq_cst);
+            }
+        } catch (...){
+            abandon(i, first + n);
+            throw;
+        }
+        publish();
+    }
+
+    template <typename T>
+    void concurrent_vector<T>::abandon(size_type first, size_type last) noexcept{
+        // Захваченные индексы уже не вернуть: каждая ячейка должна получить состояние, иначе publish() на ней встанет
+        for (size_type i = first; i < last; i++){
+            try {
+                ensure_segment(segment_of(i));
+            } catch (...){
+                // Памяти нет даже на сегмент: ячейки без блока остаются неопубликованными
+                break;
+            }
+            if constexpr (std::is_nothrow_default_constructible_v<T>){
+                std::construct_at(slot(i));
+                ready(i).store(filled, std::memory_order_seq_cst);
+            } else {
+                ready(i).store(failed, std::memory_order_seq_cst);
+            }
+        }
+        publish();
+    }
+
+    template <typename T>
+    void concurrent_vector<T>::publish() noexcept{
+        // Готовность хранится с seq_cst: поток, завершивший элемент позже, либо видит флаги следующих
+        // элементов, либо их владельцы видят его флаг, и опубликованный размер доходит до конца готового префикса.
+        // Граница берётся один раз: индексы, захваченные позже, публикуют их владельцы, поэтому число шагов
+        // ограничено и добавление не зависает при непрерывных добавлениях из других потоков
+        size_type bound = claimed.load(std::memory_order_seq_cst);
+        size_type p = published.load(std::memory_order_seq_cst);
+        while (p < bound && is_settled(p)){
+            if (published.compare_exchange_weak(p, p + 1, std::memory_order_seq_cst)){
+                p++;
+            }
+        }
+    }
+
+    template <typename T>
+    T &concurrent_vector<T>::at(size_type index){
+        if (index >= size()){
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    template <typename T>
+    const T &concurrent_vector<T>::at(size_type index) const{
+        if (index >= size()){
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    template <typename T>
+    std::size_t concurrent_vector<T>::capacity() const noexcept{
+        size_type total = 0;
+        for (size_type k = 0; k < max_segments && segments[k].block.load(std::memory_order_acquire); k++){
+            total += segment_capacity(k);
+        }
+        return total;
+    }
+
+    template <typename T>
+    void concurrent_vector<T>::reserve(size_type n){
+        ensure_range(0, n);
+    }
+
+    template <typename T>
+    template <typename ...Args>
+    std::size_t concurrent_vector<T>::emplace_back(Args &&... args) requires std::constructible_from<T, Args...>{
+        size_type index = claimed.fetch_add(1, std::memory_order_seq_cst);
+        construct_range(index, 1, [&args...](T *p){ std::construct_at(p, std::forward<Args>(args)...); });
+        return index;
+    }
+
+    template <typename T>
+    std::size_t concurrent_vector<T>::grow_by(size_type n) requires std::default_initializable<T>{
+        size_type first = claimed.fetch_add(n, std::memory_order_seq_cst);
+        construct_range(first, n, [](T *p){ std::construct_at(p); });
+        return first;
+    }
+
+    template <typename T>
+    std::size_t concurrent_vector<T>::grow_by(size_type n, const T &value) requires std::copy_constructible<T>{
+        size_type first = claimed.fetch_add(n, std::memory_order_seq_cst);
+        construct_range(first, n, [&value](T *p){ std::construct_at(p, value); });
+        return first;
+    }
+}
+
+#endif
@@ -0,0 +1,359 @@
+#ifndef MYVEC_COW_VECTOR_H
+#define MYVEC_COW_VECTOR_H
+
+#include <atomic>
+#include <span>
+#include <utility>
+#include "vector.h"
+
+namespace MyVec {
+    template <typename T, typename Allocator>
+    class cow_slice;
+
+    namespace detail {
+        /// Разделяемый блок cow_vector: счётчик ссылок и сами элементы
+        template <typename T, typename Allocator>
+        struct cow_block {
+            std::atomic<std::size_t> refs{1};
+            vector<T, Allocator> items;
+
+            template <typename ...Args>
+            explicit cow_block(Args &&... args): items(std::forward<Args>(args)...){}
+
+            static cow_block *acquire(cow_block *block) noexcept{
+                if (block){
+                    block->refs.fetch_add(1, std::memory_order_relaxed);
+                }
+                return block;
+            }
+
+            static void release(cow_block *block) noexcept{
+                // acq_rel: все чтения других владельцев завершаются до уничтожения элементов
+                if (block && block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1){
+                    delete block;
+                }
+            }
+        };
+    }
+
+    /// Вектор с копированием при записи. Копия (снимок) и срез только увеличивают атомарный счётчик ссылок
+    /// на общий блок; первая запись в разделяемый блок клонирует его. Разные объекты, ссылающиеся на один блок,
+    /// можно читать и изменять из разных потоков; один объект - как и vector, из одного потока
+    /// \tparam T Тип хранимых значений
+    /// \tparam Allocator Тип аллокатора элементов
+    template <typename T, typename Allocator = std::allocator<T>>
+    class cow_vector {
+    private:
+        using block = detail::cow_block<T, Allocator>;
+
+        block *shared = nullptr;
+    public:
+        /// Тип константного итератора (изменение элементов - через write())
+        using const_iterator = typename vector<T, Allocator>::const_iterator;
+
+        /// Тип итератора совпадает с константным
+        using iterator = const_iterator;
+
+        /// Тип хранимых значений
+        using value_type = T;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Константная ссылка на тип хранимых значений
+        using const_reference = const T &;
+
+        /// Пустой конструктор
+        cow_vector() noexcept = default;
+
+        /// Конструктор по списку инициализации
+        /// \param list Список инициализации
+        cow_vector(std::initializer_list<T> list) requires std::copy_constructible<T>: shared{new block(list)}{}
+
+        /// Конструктор, забирающий элементы вектора без копирования
+        /// \param items Вектор
+        explicit cow_vector(vector<T, Allocator> &&items): shared{new block(std::move(items))}{}
+
+        /// Конструктор, копирующий элементы вектора
+        /// \param items Вектор
+        explicit cow_vector(const vector<T, Allocator> &items) requires std::copy_constructible<T>
+                : shared{new block(items)}{}
+
+        /// Снимок: разделяет блок с second за O(1)
+        /// \param second Копируемый вектор
+        cow_vector(const cow_vector &second) noexcept: shared{block::acquire(second.shared)}{}
+
+        /// Конструктор перемещения
+        /// \param second Перемещаемый вектор
+        cow_vector(cow_vector &&second) noexcept: shared{std::exchange(second.shared, nullptr)}{}
+
+        /// Оператор присваивания снимка
+        /// \param second Копируемый вектор
+        /// \return Ссылка на текущий вектор
+        cow_vector &operator=(const cow_vector &second) noexcept{
+            block *previous = std::exchange(shared, block::acquire(second.shared));
+            block::release(previous);
+            return *this;
+        }
+
+        /// Оператор присваивания перемещением
+        /// \param second Перемещаемый вектор
+        /// \return Ссылка на текущий вектор
+        cow_vector &operator=(cow_vector &&second) noexcept{
+            if (this != &second){
+                block::release(std::exchange(shared, std::exchange(second.shared, nullptr)));
+            }
+            return *this;
+        }
+
+        /// Деструктор
+        ~cow_vector(){ block::release(shared); }
+
+        /// Возвращает снимок текущего содержимого за O(1)
+        /// \return Вектор, разделяющий блок с текущим
+        [[nodiscard]] cow_vector snapshot() const noexcept{ return *this; }
+
+        /// Возвращает срез [first, last), разделяющий владение блоком
+        /// \param first Индекс первого элемента
+        /// \param last Индекс за последним элементом
+        /// \return Срез
+        [[nodiscard]] cow_slice<T, Allocator> slice(size_type first, size_type last) const;
+
+        /// Возвращает вектор для изменения: если блок разделяется с другими снимками или срезами,
+        /// элементы сначала копируются в собственный блок
+        /// \return Ссылка на изменяемый вектор, действительная до следующего снимка
+        vector<T, Allocator> &write() requires std::copy_constructible<T>;
+
+        /// Проверяет, владеет ли вектор своим блоком единолично (запись не потребует копирования)
+        /// \return true, если блок не разделяется
+        [[nodiscard]] bool unique() const noexcept{
+            return !shared || shared->refs.load(std::memory_order_acquire) == 1;
+        }
+
+        /// Возвращает количество владельцев блока (снимков и срезов)
+        /// \return Количество владельцев, 0 для пустого вектора без блока
+        [[nodiscard]] size_type use_count() const noexcept{
+            return shared ? shared->refs.load(std::memory_order_acquire) : 0;
+        }
+
+        /// Оператор доступа к элементу по индексу
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент
+        [[nodiscard]] const T &operator[](size_type index) const{ return std::as_const(shared->items)[index]; }
+
+        /// Возвращает ссылку на элемент с проверкой индекса
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент
+        [[nodiscard]] const T &at(size_type index) const;
+
+        /// Возвращает ссылку на первый элемент
+        /// \return Константная ссылка на первый элемент
+        [[nodiscard]] const T &front() const{ return (*this)[0]; }
+
+        /// Возвращает ссылку на последний элемент
+        /// \return Константная ссылка на последний элемент
+        [[nodiscard]] const T &back() const{ return (*this)[size() - 1]; }
+
+        /// Возвращает указатель на элементы
+        /// \return Указатель на первый элемент или nullptr
+        [[nodiscard]] const T *data() const noexcept{ return shared ? std::as_const(shared->items).data() : nullptr; }
+
+        /// Возвращает размер вектора
+        /// \return Размер вектора
+        [[nodiscard]] size_type size() const noexcept{ return shared ? shared->items.size() : 0; }
+
+        /// Проверяет, является ли вектор пустым
+        /// \return true, если размер вектора равен нулю
+        [[nodiscard]] bool empty() const noexcept{ return size() == 0; }
+
+        /// Возвращает итератор на начало вектора
+        /// \return Константный итератор на начало
+        const_iterator begin() const noexcept{ return shared ? std::as_const(shared->items).begin() : const_iterator(); }
+
+        /// Возвращает итератор на конец вектора
+        /// \return Константный итератор на конец
+        const_iterator end() const noexcept{ return shared ? std::as_const(shared->items).end() : const_iterator(); }
+
+        /// Добавляет элемент в конец вектора (с клонированием разделяемого блока)
+        /// \param element Значение элемента
+        void push_back(const T &element) requires std::copy_constructible<T>{ emplace_back(element); }
+
+        /// Добавляет элемент в конец вектора (с клонированием разделяемого блока)
+        /// \param element Значение элемента
+        void push_back(T &&element) requires std::copy_constructible<T>{ emplace_back(std::move(element)); }
+
+        /// Конструирует элемент в конце вектора (с клонированием разделяемого блока)
+        /// \param args Аргументы конструктора
+        template <typename ...Args>
+        void emplace_back(Args &&... args) requires std::constructible_from<T, Args...> && std::copy_constructible<T>;
+
+        /// Изменяет элемент по индексу (с клонированием разделяемого блока)
+        /// \param index Индекс элемента
+        /// \param value Новое значение
+        void set(size_type index, T value) requires std::copy_constructible<T>{ write().at(index) = std::move(value); }
+
+        /// Удаляет последний элемент (с клонированием разделяемого блока)
+        void pop_back() requires std::copy_constructible<T>{
+            vector<T, Allocator> &items = write();
+            items.erase(items.end() - 1);
+        }
+
+        /// Отпускает блок; другие снимки и срезы сохраняют элементы
+        void clear() noexcept{ block::release(std::exchange(shared, nullptr)); }
+
+        /// Обменивает содержимое векторов
+        /// \param second Второй вектор
+        void swap(cow_vector &second) noexcept{ std::swap(shared, second.shared); }
+    };
+
+    /// Срез cow_vector: непрерывный диапазон элементов, разделяющий владение блоком. Блок остаётся жив,
+    /// пока жив срез, даже если исходный вектор изменён или уничтожен
+    /// \tparam T Тип хранимых значений
+    /// \tparam Allocator Тип аллокатора элементов
+    template <typename T, typename Allocator = std::allocator<T>>
+    class cow_slice {
+    private:
+        using block = detail::cow_block<T, Allocator>;
+
+        block *shared = nullptr;
+        std::size_t offset = 0;
+        std::size_t length = 0;
+
+        cow_slice(block *shared, std::size_t offset, std::size_t length) noexcept
+                : shared{block::acquire(shared)}, offset{offset}, length{length}{}
+
+        friend class cow_vector<T, Allocator>;
+    public:
+        /// Тип константного итератора
+        using const_iterator = typename vector<T, Allocator>::const_iterator;
+
+        /// Тип итератора совпадает с константным
+        using iterator = const_iterator;
+
+        /// Тип хранимых значений
+        using value_type = T;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+
+        /// Пустой срез
+        cow_slice() noexcept = default;
+
+        /// Конструктор копирования: увеличивает счётчик ссылок блока
+        /// \param second Копируемый срез
+        cow_slice(const cow_slice &second) noexcept: cow_slice(second.shared, second.offset, second.length){}
+
+        /// Конструктор перемещения
+        /// \param second Перемещаемый срез
+        cow_slice(cow_slice &&second) noexcept
+                : shared{std::exchange(second.shared, nullptr)}, offset{second.offset}, length{std::exchange(second.length, 0)}{}
+
+        /// Оператор присваивания
+        /// \param second Копируемый или перемещаемый срез
+        /// \return Ссылка на текущий срез
+        cow_slice &operator=(cow_slice second) noexcept{
+            std::swap(shared, second.shared);
+            std::swap(offset, second.offset);
+            std::swap(length, second.length);
+            return *this;
+        }
+
+        /// Деструктор
+        ~cow_slice(){ block::release(shared); }
+
+        /// Возвращает подсрез [first, last) относительно начала среза
+        /// \param first Индекс первого элемента
+        /// \param last Индекс за последним элементом
+        /// \return Срез
+        [[nodiscard]] cow_slice subslice(size_type first, size_type last) const{
+            if (first > last || last > length){
+                throw std::out_of_range("Slice is out of range");
+            }
+            return cow_slice(shared, offset + first, last - first);
+        }
+
+        /// Оператор доступа к элементу по индексу
+        /// \param index Индекс элемента относительно начала среза
+        /// \return Константная ссылка на элемент
+        [[nodiscard]] const T &operator[](size_type index) const{ return std::as_const(shared->items)[offset + index]; }
+
+        /// Возвращает ссылку на элемент с проверкой индекса
+        /// \param index Индекс элемента относительно начала среза
+        /// \return Константная ссылка на элемент
+        [[nodiscard]] const T &at(size_type index) const{
+            if (index >= length){
+                throw std::out_of_range("Index out of range");
+            }
+            return (*this)[index];
+        }
+
+        /// Возвращает указатель на первый элемент среза
+        /// \return Указатель на первый элемент или nullptr
+        [[nodiscard]] const T *data() const noexcept{
+            return shared ? std::as_const(shared->items).data() + offset : nullptr;
+        }
+
+        /// Возвращает элементы среза как std::span
+        /// \return span элементов
+        [[nodiscard]] std::span<const T> span() const noexcept{ return {data(), length}; }
+
+        /// Возвращает размер среза
+        /// \return Количество элементов
+        [[nodiscard]] size_type size() const noexcept{ return length; }
+
+        /// Проверяет, является ли срез пустым
+        /// \return true, если размер среза равен нулю
+        [[nodiscard]] bool empty() const noexcept{ return length == 0; }
+
+        /// Возвращает итератор на начало среза
+        /// \return Константный итератор на начало
+        const_iterator begin() const noexcept{
+            return shared ? std::as_const(shared->items).begin() + offset : const_iterator();
+        }
+
+        /// Возвращает итератор на конец среза
+        /// \return Константный итератор на конец
+        const_iterator end() const noexcept{ return shared ? begin() + length : const_iterator(); }
+    };
+}
+
+namespace MyVec {
+    template <typename T, typename Allocator>
+    cow_slice<T, Allocator> cow_vector<T, Allocator>::slice(size_type first, size_type last) const{
+        if (first > last || last > size()){
+            throw std::out_of_range("Slice is out of range");
+        }
+        return cow_slice<T, Allocator>(shared, first, last - first);
+    }
+
+    template <typename T, typename Allocator>
+    vector<T, Allocator> &cow_vector<T, Allocator>::write() requires std::copy_constructible<T>{
+        if (!shared){
+            shared = new block();
+        } else if (shared->refs.load(std::memory_order_acquire) != 1){
+            block *clone = new block(std::as_const(shared->items));
+            block::release(std::exchange(shared, clone));
+        }
+        return shared->items;
+    }
+
+    template <typename T, typename Allocator>
+    const T &cow_vector<T, Allocator>::at(size_type index) const{
+        if (index >= size()){
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    template <typename T, typename Allocator>
+    template <typename ...Args>
+    void cow_vector<T, Allocator>::emplace_back(Args &&... args)
+    requires std::constructible_from<T, Args...> && std::copy_constructible<T>{
+        write().emplace_back(std::forward<Args>(args)...);
+    }
+}
+
+#endif
@@ -0,0 +1,792 @@
+#ifndef MYVEC_FLAT_MAP_H
+#define MYVEC_FLAT_MAP_H
+
+#include <functional>
+#include <utility>
+#include "vector.h"
+#include "soa_vector.h"
+
+namespace MyVec {
+    namespace detail {
+        /// Компаратор, допускающий поиск по значениям других типов (std::less<>, std::ranges::less и т.п.)
+        template <typename Compare>
+        concept transparent_compare = requires { typename Compare::is_transparent; };
+
+        /// Двоичный поиск без ветвлений: индекс первого элемента [first, first + n), для которого before вернул false
+        /// (последовательность должна быть разбита предикатом). Выбор половины сводится к условной пересылке,
+        /// а обе возможные середины следующего шага запрашиваются заранее, поэтому на больших массивах
+        /// промахи кэша перекрываются, а неверно предсказанных переходов нет
+        /// \param first Начало отсортированного массива
+        /// \param n Количество элементов
+        /// \param before Предикат "элемент находится до искомой позиции"
+        /// \return Индекс позиции
+        template <typename Key, typename Pred>
+        std::size_t partition_index(const Key *first, std::size_t n, Pred before){
+            if (n == 0){
+                return 0;
+            }
+            const Key *base = first;
+            while (n > 1){
+                std::size_t half = n / 2;
+                __builtin_prefetch(base + half / 2);
+                __builtin_prefetch(base + half + half / 2);
+                base = before(base[half]) ? base + half : base;
+                n -= half;
+            }
+            return static_cast<std::size_t>(base - first) + static_cast<std::size_t>(before(*base));
+        }
+
+        /// Слияние добавленного хвоста с отсортированной частью: [first, middle) отсортирован и не содержит равных,
+        /// [middle, last) - добавленные элементы. Хвост сортируется устойчиво, из него удаляются повторы (остаётся
+        /// первый добавленный) и элементы, равные уже имеющимся, после чего части сливаются на месте.
+        /// Вместо n вставок со сдвигом - O(k log k) на хвост и один линейный проход слияния
+        /// \param first Начало отсортированной части
+        /// \param middle Начало хвоста
+        /// \param last Конец хвоста
+        /// \param less Строгий порядок
+        /// \return Новый конец последовательности; элементы [результат, last) остаются перемещёнными и удаляются вызывающим
+        template <typename It, typename Less>
+        It merge_tail(It first, It middle, It last, Less less){
+            if (!std::is_sorted(middle, last, less)){
+                std::stable_sort(middle, last, less);
+            }
+            It out = middle;
+            It cursor = first;
+            for (It it = middle; it != last; ++it){
+                if (out != middle && !less(*(out - 1), *it)){
+                    continue;
+                }
+                // Хвост отсортирован, поэтому граница поиска в старой части только сдвигается вправо
+                cursor = std::lower_bound(cursor, middle, *it, less);
+                if (cursor != middle && !less(*it, *cursor)){
+                    continue;
+                }
+                if (out != it){
+                    *out = std::move(*it);
+                }
+                ++out;
+            }
+            if (first != middle && out != middle && less(*middle, *(middle - 1))){
+                std::inplace_merge(first, middle, out, less);
+            }
+            return out;
+        }
+    }
+
+    /// Упорядоченное множество на отсортированном vector: поиск - двоичный без ветвлений по непрерывному массиву,
+    /// вставка диапазона - добавление в конец, сортировка хвоста и слияние на месте.
+    /// Вставка и удаление одного элемента сдвигают хвост и делают итераторы недействительными
+    /// \tparam Key Тип ключей
+    /// \tparam Compare Строгий порядок ключей; с is_transparent поиск принимает значения других типов
+    template <typename Key, typename Compare = std::less<Key>>
+    class flat_set {
+    public:
+        /// Тип ключей
+        using key_type = Key;
+
+        /// Тип хранимых значений
+        using value_type = Key;
+
+        /// Порядок ключей
+        using key_compare = Compare;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами
+        using difference_type = std::ptrdiff_t;
+
+        /// Итератор (ключи изменять нельзя, поэтому совпадает с константным)
+        using iterator = VectorIterator<Key, true>;
+
+        /// Константный итератор
+        using const_iterator = VectorIterator<Key, true>;
+    private:
+        vector<Key> _keys;
+        [[no_unique_address]] Compare comp{};
+
+        template <typename K>
+        size_type lower_index(const K &key) const{
+            return detail::partition_index(_keys.data(), _keys.size(), [&](const Key &x){ return comp(x, key); });
+        }
+
+        template <typename K>
+        size_type upper_index(const K &key) const{
+            return detail::partition_index(_keys.data(), _keys.size(), [&](const Key &x){ return !comp(key, x); });
+        }
+
+        template <typename K>
+        size_type find_index(const K &key) const{
+            size_type i = lower_index(key);
+            return i != _keys.size() && !comp(key, _keys[i]) ? i : _keys.size();
+        }
+
+        iterator at_index(size_type i) const noexcept{ return _keys.begin() + static_cast<difference_type>(i); }
+
+        template <typename K>
+        std::pair<iterator, bool> insert_unique(K &&key);
+    public:
+        /// Пустой конструктор
+        flat_set() = default;
+
+        /// Конструктор пустого множества с заданным порядком
+        /// \param compare Порядок ключей
+        explicit flat_set(const Compare &compare) : comp{compare}{}
+
+        /// Конструктор из списка инициализации; повторяющиеся ключи пропускаются
+        /// \param list Ключи
+        /// \param compare Порядок ключей
+        flat_set(std::initializer_list<Key> list, const Compare &compare = Compare()) : comp{compare}{
+            insert(list.begin(), list.end());
+        }
+
+        /// Конструктор из диапазона [first, last); повторяющиеся ключи пропускаются
+        /// \param first Итератор на начало диапазона
+        /// \param last Конец диапазона
+        /// \param compare Порядок ключей
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires std::constructible_from<Key, std::iter_reference_t<It>>
+        flat_set(It first, S last, const Compare &compare = Compare()) : comp{compare}{
+            insert(std::move(first), std::move(last));
+        }
+
+        /// Получение итератора на начало множества
+        /// \return Итератор на наименьший ключ
+        iterator begin() const noexcept{ return _keys.begin(); }
+
+        /// Получение итератора на конец множества
+        /// \return Итератор, адресующий конец множества
+        iterator end() const noexcept{ return _keys.end(); }
+
+        /// Получение константного итератора на начало множества
+        /// \return Итератор на наименьший ключ
+        const_iterator cbegin() const noexcept{ return _keys.cbegin(); }
+
+        /// Получение константного итератора на конец множества
+        /// \return Итератор, адресующий конец множества
+        const_iterator cend() const noexcept{ return _keys.cend(); }
+
+        /// Возвращает количество ключей
+        /// \return Размер множества
+        [[nodiscard]] size_type size() const noexcept{ return _keys.size(); }
+
+        /// Проверяет, является ли множество пустым
+        /// \return true, если множество пусто
+        [[nodiscard]] bool empty() const noexcept{ return _keys.empty(); }
+
+        /// Резервирует память под n ключей
+        /// \param n Ёмкость
+        void reserve(size_type n){ _keys.reserve(n); }
+
+        /// Удаляет все ключи
+        void clear() noexcept{ _keys.clear(); }
+
+        /// Возвращает отсортированный массив ключей
+        /// \return Ссылка на массив ключей
+        [[nodiscard]] const vector<Key> &keys() const noexcept{ return _keys; }
+
+        /// Возвращает порядок ключей
+        /// \return Компаратор
+        [[nodiscard]] key_compare key_comp() const{ return comp; }
+
+        /// Вставляет копию ключа, если такого ещё нет
+        /// \param key Ключ
+        /// \return Итератор на ключ и true, если ключ вставлен
+        std::pair<iterator, bool> insert(const Key &key){ return insert_unique(key); }
+
+        /// Вставляет ключ перемещением, если такого ещё нет
+        /// \param key Ключ
+        /// \return Итератор на ключ и true, если ключ вставлен
+        std::pair<iterator, bool> insert(Key &&key){ return insert_unique(std::move(key)); }
+
+        /// Конструирует ключ и вставляет его, если такого ещё нет
+        /// \param args Аргументы для конструирования ключа
+        /// \return Итератор на ключ и true, если ключ вставлен
+        template <typename ...Args>
+        requires std::constructible_from<Key, Args...>
+        std::pair<iterator, bool> emplace(Args &&... args){ return insert_unique(Key(std::forward<Args>(args)...)); }
+
+        /// Вставляет ключи диапазона [first, last) одним слиянием: ключи добавляются в конец, хвост сортируется,
+        /// повторы отбрасываются, затем хвост сливается с множеством на месте.
+        /// При исключении множество очищается
+        /// \param first Итератор на начало диапазона
+        /// \param last Конец диапазона
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires std::constructible_from<Key, std::iter_reference_t<It>>
+        void insert(It first, S last);
+
+        /// Вставляет ключи из списка инициализации одним слиянием
+        /// \param list Ключи
+        void insert(std::initializer_list<Key> list){ insert(list.begin(), list.end()); }
+
+        /// Удаляет ключ по итератору
+        /// \param pos Итератор на ключ
+        /// \return Итератор на следующий ключ
+        iterator erase(const_iterator pos){
+            size_type i = pos - begin();
+            _keys.erase(_keys.begin() + static_cast<difference_type>(i));
+            return at_index(i);
+        }
+
+        /// Удаляет ключ
+        /// \param key Ключ
+        /// \return Количество удалённых ключей (0 или 1)
+        size_type erase(const Key &key);
+
+        /// Поиск ключа
+        /// \param key Ключ
+        /// \return Итератор на ключ или end()
+        iterator find(const Key &key) const{ return at_index(find_index(key)); }
+
+        /// Поиск ключа по значению другого типа (только для прозрачного компаратора)
+        /// \param key Значение, сравнимое с ключами
+        /// \return Итератор на ключ или end()
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        iterator find(const K &key) const{ return at_index(find_index(key)); }
+
+        /// Проверяет наличие ключа
+        /// \param key Ключ
+        /// \return true, если ключ есть в множестве
+        [[nodiscard]] bool contains(const Key &key) const{ return find_index(key) != size(); }
+
+        /// Проверяет наличие ключа по значению другого типа (только для прозрачного компаратора)
+        /// \param key Значение, сравнимое с ключами
+        /// \return true, если ключ есть в множестве
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        [[nodiscard]] bool contains(const K &key) const{ return find_index(key) != size(); }
+
+        /// Количество ключей, равных key
+        /// \param key Ключ
+        /// \return 0 или 1
+        [[nodiscard]] size_type count(const Key &key) const{ return contains(key); }
+
+        /// Количество ключей, равных key (только для прозрачного компаратора)
+        /// \param key Значение, сравнимое с ключами
+        /// \return 0 или 1
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        [[nodiscard]] size_type count(const K &key) const{ return contains(key); }
+
+        /// Первый ключ, не меньший key
+        /// \param key Ключ
+        /// \return Итератор на ключ или end()
+        iterator lower_bound(const Key &key) const{ return at_index(lower_index(key)); }
+
+        /// Первый ключ, не меньший key (только для прозрачного компаратора)
+        /// \param key Значение, сравнимое с ключами
+        /// \return Итератор на ключ или end()
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        iterator lower_bound(const K &key) const{ return at_index(lower_index(key)); }
+
+        /// Первый ключ, больший key
+        /// \param key Ключ
+        /// \return Итератор на ключ или end()
+        iterator upper_bound(const Key &key) const{ return at_index(upper_index(key)); }
+
+        /// Первый ключ, больший key (только для прозрачного компаратора)
+        /// \param key Значение, сравнимое с ключами
+        /// \return Итератор на ключ или end()
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        iterator upper_bound(const K &key) const{ return at_index(upper_index(key)); }
+
+        /// Обменивает содержимое двух множеств
+        /// \param second Другое множество
+        void swap(flat_set &second) noexcept{
+            _keys.swap(second._keys);
+            std::swap(comp, second.comp);
+        }
+    };
+
+    /// Упорядоченный словарь на двух отсортированных vector (ключи и значения хранятся раздельно, поэтому
+    /// двоичный поиск читает только ключи). Поиск без ветвлений, вставка диапазона - добавление в конец,
+    /// сортировка хвоста и слияние на месте. Итератор разыменовывается в пару ссылок (const Key&, T&),
+    /// которая раскладывается structured bindings или get<0>/get<1>.
+    /// Вставка и удаление одного элемента сдвигают хвосты и делают итераторы недействительными
+    /// \tparam Key Тип ключей
+    /// \tparam T Тип значений
+    /// \tparam Compare Строгий порядок ключей; с is_transparent поиск принимает значения других типов
+    template <typename Key, typename T, typename Compare = std::less<Key>>
+    class flat_map {
+    public:
+        /// Тип ключей
+        using key_type = Key;
+
+        /// Тип значений
+        using mapped_type = T;
+
+        /// Тип элемента при вставке
+        using value_type = std::pair<Key, T>;
+
+        /// Порядок ключей
+        using key_compare = Compare;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами
+        using difference_type = std::ptrdiff_t;
+
+        /// Итератор: ключ доступен только для чтения, значение - для записи
+        using iterator = SoaIterator<false, const Key, T>;
+
+        /// Константный итератор
+        using const_iterator = SoaIterator<true, const Key, T>;
+    private:
+        vector<Key> _keys;
+        vector<T> _values;
+        [[no_unique_address]] Compare comp{};
+
+        template <typename K>
+        size_type lower_index(const K &key) const{
+            return detail::partition_index(_keys.data(), _keys.size(), [&](const Key &x){ return comp(x, key); });
+        }
+
+        template <typename K>
+        size_type upper_index(const K &key) const{
+            return detail::partition_index(_keys.data(), _keys.size(), [&](const Key &x){ return !comp(key, x); });
+        }
+
+        template <typename K>
+        size_type find_index(const K &key) const{
+            size_type i = lower_index(key);
+            return i != _keys.size() && !comp(key, _keys[i]) ? i : _keys.size();
+        }
+
+        iterator at_index(size_type i) noexcept{
+            return iterator({_keys.data(), _values.data()}, static_cast<difference_type>(i));
+        }
+
+        const_iterator at_index(size_type i) const noexcept{
+            return const_iterator({_keys.data(), _values.data()}, static_cast<difference_type>(i));
+        }
+
+        template <typename K, typename ...Args>
+        std::pair<iterator, bool> emplace_unique(K &&key, Args &&... args);
+    public:
+        /// Пустой конструктор
+        flat_map() = default;
+
+        /// Конструктор пустого словаря с заданным порядком
+        /// \param compare Порядок ключей
+        explicit flat_map(const Compare &compare) : comp{compare}{}
+
+        /// Конструктор из списка инициализации; из повторяющихся ключей остаётся первый
+        /// \param list Пары (ключ, значение)
+        /// \param compare Порядок ключей
+        flat_map(std::initializer_list<value_type> list, const Compare &compare = Compare()) : comp{compare}{
+            insert(list.begin(), list.end());
+        }
+
+        /// Конструктор из диапазона пар [first, last); из повторяющихся ключей остаётся первый
+        /// \param first Итератор на начало диапазона
+        /// \param last Конец диапазона
+        /// \param compare Порядок ключей
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires std::constructible_from<value_type, std::iter_reference_t<It>>
+        flat_map(It first, S last, const Compare &compare = Compare()) : comp{compare}{
+            insert(std::move(first), std::move(last));
+        }
+
+        /// Получение итератора на начало словаря
+        /// \return Итератор на элемент с наименьшим ключом
+        iterator begin() noexcept{ return at_index(0); }
+
+        /// Получение итератора на конец словаря
+        /// \return Итератор, адресующий конец словаря
+        iterator end() noexcept{ return at_index(size()); }
+
+        /// Получение константного итератора на начало словаря
+        /// \return Итератор на элемент с наименьшим ключом
+        const_iterator begin() const noexcept{ return at_index(0); }
+
+        /// Получение константного итератора на конец словаря
+        /// \return Итератор, адресующий конец словаря
+        const_iterator end() const noexcept{ return at_index(size()); }
+
+        /// Получение константного итератора на начало словаря
+        /// \return Итератор на элемент с наименьшим ключом
+        const_iterator cbegin() const noexcept{ return at_index(0); }
+
+        /// Получение константного итератора на конец словаря
+        /// \return Итератор, адресующий конец словаря
+        const_iterator cend() const noexcept{ return at_index(size()); }
+
+        /// Возвращает количество элементов
+        /// \return Размер словаря
+        [[nodiscard]] size_type size() const noexcept{ return _keys.size(); }
+
+        /// Проверяет, является ли словарь пустым
+        /// \return true, если словарь пуст
+        [[nodiscard]] bool empty() const noexcept{ return _keys.empty(); }
+
+        /// Резервирует память под n элементов
+        /// \param n Ёмкость
+        void reserve(size_type n){
+            _keys.reserve(n);
+            _values.reserve(n);
+        }
+
+        /// Удаляет все элементы
+        void clear() noexcept{
+            _keys.clear();
+            _values.clear();
+        }
+
+        /// Возвращает отсортированный массив ключей
+        /// \return Ссылка на массив ключей
+        [[nodiscard]] const vector<Key> &keys() const noexcept{ return _keys; }
+
+        /// Возвращает массив значений в порядке ключей
+        /// \return Ссылка на массив значений
+        [[nodiscard]] const vector<T> &values() const noexcept{ return _values; }
+
+        /// Возвращает порядок ключей
+        /// \return Компаратор
+        [[nodiscard]] key_compare key_comp() const{ return comp; }
+
+        /// Возвращает значение по ключу, вставляя T(), если ключа нет
+        /// \param key Ключ
+        /// \return Ссылка на значение
+        T &operator[](const Key &key) requires std::default_initializable<T>{
+            return get<1>(*try_emplace(key).first);
+        }
+
+        /// Возвращает значение по ключу, вставляя T(), если ключа нет
+        /// \param key Ключ (перемещается только при вставке)
+        /// \return Ссылка на значение
+        T &operator[](Key &&key) requires std::default_initializable<T>{
+            return get<1>(*try_emplace(std::move(key)).first);
+        }
+
+        /// Возвращает значение по ключу с проверкой наличия
+        /// \param key Ключ
+        /// \return Ссылка на значение
+        [[nodiscard]] T &at(const Key &key);
+
+        /// Возвращает значение по ключу с проверкой наличия (константная версия)
+        /// \param key Ключ
+        /// \return Константная ссылка на значение
+        [[nodiscard]] const T &at(const Key &key) const;
+
+        /// Конструирует значение по ключу, если ключа ещё нет; иначе аргументы не используются
+        /// \param key Ключ
+        /// \param args Аргументы для конструирования значения
+        /// \return Итератор на элемент и true, если элемент вставлен
+        template <typename ...Args>
+        requires std::constructible_from<T, Args...>
+        std::pair<iterator, bool> try_emplace(const Key &key, Args &&... args){
+            return emplace_unique(key, std::forward<Args>(args)...);
+        }
+
+        /// Конструирует значение по ключу, если ключа ещё нет; иначе ключ и аргументы не используются
+        /// \param key Ключ
+        /// \param args Аргументы для конструирования значения
+        /// \return Итератор на элемент и true, если элемент вставлен
+        template <typename ...Args>
+        requires std::constructible_from<T, Args...>
+        std::pair<iterator, bool> try_emplace(Key &&key, Args &&... args){
+            return emplace_unique(std::move(key), std::forward<Args>(args)...);
+        }
+
+        /// Вставляет копию пары, если ключа ещё нет
+        /// \param element Пара (ключ, значение)
+        /// \return Итератор на элемент и true, если элемент вставлен
+        std::pair<iterator, bool> insert(const value_type &element){
+            return emplace_unique(element.first, element.second);
+        }
+
+        /// Вставляет пару перемещением, если ключа ещё нет
+        /// \param element Пара (ключ, значение)
+        /// \return Итератор на элемент и true, если элемент вставлен
+        std::pair<iterator, bool> insert(value_type &&element){
+            return emplace_unique(std::move(element.first), std::move(element.second));
+        }
+
+        /// Вставляет значение или присваивает его, если ключ уже есть
+        /// \param key Ключ
+        /// \param value Значение
+        /// \return Итератор на элемент и true, если элемент вставлен
+        template <typename M>
+        requires std::assignable_from<T &, M &&> && std::constructible_from<T, M &&>
+        std::pair<iterator, bool> insert_or_assign(const Key &key, M &&value);
+
+        /// Вставляет пары диапазона [first, last) одним слиянием: пары добавляются в конец, хвост сортируется
+        /// по ключу, повторы отбрасываются (остаётся первый добавленный, имеющиеся значения не заменяются),
+        /// затем хвост сливается со словарём на месте. При исключении словарь очищается
+        /// \param first Итератор на начало диапазона
+        /// \param last Конец диапазона
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires std::constructible_from<value_type, std::iter_reference_t<It>>
+        void insert(It first, S last);
+
+        /// Вставляет пары из списка инициализации одним слиянием
+        /// \param list Пары (ключ, значение)
+        void insert(std::initializer_list<value_type> list){ insert(list.begin(), list.end()); }
+
+        /// Удаляет элемент по итератору
+        /// \param pos Итератор на элемент
+        /// \return Итератор на следующий элемент
+        iterator erase(const_iterator pos);
+
+        /// Удаляет элемент по ключу
+        /// \param key Ключ
+        /// \return Количество удалённых элементов (0 или 1)
+        size_type erase(const Key &key);
+
+        /// Поиск ключа
+        /// \param key Ключ
+        /// \return Итератор на элемент или end()
+        iterator find(const Key &key){ return at_index(find_index(key)); }
+
+        /// Поиск ключа (константная версия)
+        /// \param key Ключ
+        /// \return Итератор на элемент или end()
+        const_iterator find(const Key &key) const{ return at_index(find_index(key)); }
+
+        /// Поиск ключа по значению другого типа (только для прозрачного компаратора)
+        /// \param key Значение, сравнимое с ключами
+        /// \return Итератор на элемент или end()
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        iterator find(const K &key){ return at_index(find_index(key)); }
+
+        /// Поиск ключа по значению другого типа (только для прозрачного компаратора, константная версия)
+        /// \param key Значение, сравнимое с ключами
+        /// \return Итератор на элемент или end()
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        const_iterator find(const K &key) const{ return at_index(find_index(key)); }
+
+        /// Проверяет наличие ключа
+        /// \param key Ключ
+        /// \return true, если ключ есть в словаре
+        [[nodiscard]] bool contains(const Key &key) const{ return find_index(key) != size(); }
+
+        /// Проверяет наличие ключа по значению другого типа (только для прозрачного компаратора)
+        /// \param key Значение, сравнимое с ключами
+        /// \return true, если ключ есть в словаре
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        [[nodiscard]] bool contains(const K &key) const{ return find_index(key) != size(); }
+
+        /// Количество элементов с ключом key
+        /// \param key Ключ
+        /// \return 0 или 1
+        [[nodiscard]] size_type count(const Key &key) const{ return contains(key); }
+
+        /// Количество элементов с ключом key (только для прозрачного компаратора)
+        /// \param key Значение, сравнимое с ключами
+        /// \return 0 или 1
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        [[nodiscard]] size_type count(const K &key) const{ return contains(key); }
+
+        /// Первый элемент с ключом, не меньшим key
+        /// \param key Ключ
+        /// \return Итератор на элемент или end()
+        iterator lower_bound(const Key &key){ return at_index(lower_index(key)); }
+
+        /// Первый элемент с ключом, не меньшим key (константная версия)
+        /// \param key Ключ
+        /// \return Итератор на элемент или end()
+        const_iterator lower_bound(const Key &key) const{ return at_index(lower_index(key)); }
+
+        /// Первый элемент с ключом, не меньшим key (только для прозрачного компаратора)
+        /// \param key Значение, сравнимое с ключами
+        /// \return Итератор на элемент или end()
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        iterator lower_bound(const K &key){ return at_index(lower_index(key)); }
+
+        /// Первый элемент с ключом, не меньшим key (только для прозрачного компаратора, константная версия)
+        /// \param key Значение, сравнимое с ключами
+        /// \return Итератор на элемент или end()
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        const_iterator lower_bound(const K &key) const{ return at_index(lower_index(key)); }
+
+        /// Первый элемент с ключом, большим key
+        /// \param key Ключ
+        /// \return Итератор на элемент или end()
+        iterator upper_bound(const Key &key){ return at_index(upper_index(key)); }
+
+        /// Первый элемент с ключом, большим key (константная версия)
+        /// \param key Ключ
+        /// \return Итератор на элемент или end()
+        const_iterator upper_bound(const Key &key) const{ return at_index(upper_index(key)); }
+
+        /// Первый элемент с ключом, большим key (только для прозрачного компаратора)
+        /// \param key Значение, сравнимое с ключами
+        /// \return Итератор на элемент или end()
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        iterator upper_bound(const K &key){ return at_index(upper_index(key)); }
+
+        /// Первый элемент с ключом, большим key (только для прозрачного компаратора, константная версия)
+        /// \param key Значение, сравнимое с ключами
+        /// \return Итератор на элемент или end()
+        template <typename K>
+        requires detail::transparent_compare<Compare>
+        const_iterator upper_bound(const K &key) const{ return at_index(upper_index(key)); }
+
+        /// Обменивает содержимое двух словарей
+        /// \param second Другой словарь
+        void swap(flat_map &second) noexcept{
+            _keys.swap(second._keys);
+            _values.swap(second._values);
+            std::swap(comp, second.comp);
+        }
+    };
+}
+
+namespace MyVec {
+    template <typename Key, typename Compare>
+    template <typename K>
+    std::pair<VectorIterator<Key, true>, bool> flat_set<Key, Compare>::insert_unique(K &&key){
+        size_type i = lower_index(key);
+        if (i != size() && !comp(key, _keys[i])){
+            return {at_index(i), false};
+        }
+        _keys.insert(_keys.begin() + static_cast<difference_type>(i), std::forward<K>(key));
+        return {at_index(i), true};
+    }
+
+    template <typename Key, typename Compare>
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    requires std::constructible_from<Key, std::iter_reference_t<It>>
+    void flat_set<Key, Compare>::insert(It first, S last){
+        size_type old = size();
+        try {
+            if constexpr (std::forward_iterator<It> || std::sized_sentinel_for<S, It>){
+                _keys.reserve(old + static_cast<size_type>(std::ranges::distance(first, last)));
+            }
+            for (; first != last; ++first){
+                _keys.emplace_back(*first);
+            }
+            auto less = [this](const Key &a, const Key &b){ return comp(a, b); };
+            auto begin = _keys.begin();
+            auto end = detail::merge_tail(begin, begin + static_cast<difference_type>(old), _keys.end(), less);
+            _keys.erase(end, _keys.end());
+        } catch (...){
+            // Порядок уже мог быть нарушен сортировкой или слиянием
+            clear();
+            throw;
+        }
+    }
+
+    template <typename Key, typename Compare>
+    std::size_t flat_set<Key, Compare>::erase(const Key &key){
+        size_type i = find_index(key);
+        if (i == size()){
+            return 0;
+        }
+        _keys.erase(_keys.begin() + static_cast<difference_type>(i));
+        return 1;
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename K, typename ...Args>
+    std::pair<SoaIterator<false, const Key, T>, bool> flat_map<Key, T, Compare>::emplace_unique(K &&key, Args &&... args){
+        size_type i = lower_index(key);
+        if (i != size() && !comp(key, _keys[i])){
+            return {at_index(i), false};
+        }
+        auto position = static_cast<difference_type>(i);
+        _keys.insert(_keys.begin() + position, std::forward<K>(key));
+        try {
+            _values.emplace(_values.begin() + position, std::forward<Args>(args)...);
+        } catch (...){
+            _keys.erase(_keys.begin() + position);
+            throw;
+        }
+        return {at_index(i), true};
+    }
+
+    template <typename Key, typename T, typename Compare>
+    T &flat_map<Key, T, Compare>::at(const Key &key){
+        size_type i = find_index(key);
+        if (i == size()){
+            throw std::out_of_range("Key is not found");
+        }
+        return _values[i];
+    }
+
+    template <typename Key, typename T, typename Compare>
+    const T &flat_map<Key, T, Compare>::at(const Key &key) const{
+        size_type i = find_index(key);
+        if (i == size()){
+            throw std::out_of_range("Key is not found");
+        }
+        return _values[i];
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <typename M>
+    requires std::assignable_from<T &, M &&> && std::constructible_from<T, M &&>
+    std::pair<SoaIterator<false, const Key, T>, bool> flat_map<Key, T, Compare>::insert_or_assign(const Key &key,
+                                                                                                  M &&value){
+        size_type i = find_index(key);
+        if (i != size()){
+            _values[i] = std::forward<M>(value);
+            return {at_index(i), false};
+        }
+        return emplace_unique(key, std::forward<M>(value));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    requires std::constructible_from<std::pair<Key, T>, std::iter_reference_t<It>>
+    void flat_map<Key, T, Compare>::insert(It first, S last){
+        size_type old = size();
+        try {
+            if constexpr (std::forward_iterator<It> || std::sized_sentinel_for<S, It>){
+                reserve(old + static_cast<size_type>(std::ranges::distance(first, last)));
+            }
+            for (; first != last; ++first){
+                value_type element(*first);
+                _keys.push_back(std::move(element.first));
+                _values.push_back(std::move(element.second));
+            }
+            // Строки (ключ, значение) переставляются вместе через итератор по двум столбцам
+            using rows = SoaIterator<false, Key, T>;
+            rows begin({_keys.data(), _values.data()}, 0);
+            auto less = [this](const auto &a, const auto &b){
+                using std::get;
+                return comp(get<0>(a), get<0>(b));
+            };
+            rows end = detail::merge_tail(begin, begin + static_cast<difference_type>(old),
+                                          begin + static_cast<difference_type>(size()), less);
+            auto kept = end - begin;
+            _keys.erase(_keys.begin() + kept, _keys.end());
+            _values.erase(_values.begin() + kept, _values.end());
+        } catch (...){
+            // Порядок уже мог быть нарушен сортировкой или слиянием, а столбцы - разойтись по длине
+            clear();
+            throw;
+        }
+    }
+
+    template <typename Key, typename T, typename Compare>
+    SoaIterator<false, const Key, T> flat_map<Key, T, Compare>::erase(const_iterator pos){
+        difference_type i = pos.position();
+        _keys.erase(_keys.begin() + i);
+        _values.erase(_values.begin() + i);
+        return at_index(static_cast<size_type>(i));
+    }
+
+    template <typename Key, typename T, typename Compare>
+    std::size_t flat_map<Key, T, Compare>::erase(const Key &key){
+        size_type i = find_index(key);
+        if (i == size()){
+            return 0;
+        }
+        erase(at_index(i));
+        return 1;
+    }
+}
+
+#endif
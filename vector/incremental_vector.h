@@ -0,0 +1,576 @@
+#ifndef MYVEC_INCREMENTAL_VECTOR_H
+#define MYVEC_INCREMENTAL_VECTOR_H
+
+#include "vector.h"
+
+namespace MyVec {
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    class incremental_vector;
+
+    /// Итератор incremental_vector: индекс элемента, во время переноса элемент может лежать в любом из двух блоков
+    /// \tparam Container Тип контейнера (const для const_iterator)
+    /// \tparam T адресуемый итератором тип
+    /// \tparam is_const итератор является const_iterator если true, обычным iterator в ином случае
+    template <typename Container, typename T, bool is_const>
+    class IncrementalIterator {
+    private:
+        using container = std::conditional_t<is_const, const Container, Container>;
+
+        container *owner = nullptr;
+        std::ptrdiff_t index = 0;
+    public:
+        /// Категория итератора
+        using iterator_category = std::random_access_iterator_tag;
+
+        /// Адресуемый итератором тип
+        using value_type = T;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Тип указателя на хранимое значение, для const_iterator - const T*, для обычного - T*
+        using pointer = std::conditional_t<is_const, const T *, T *>;
+
+        /// Тип ссылки на хранимое значение, для const_iterator - const T&, для обычного - T&
+        using reference = std::conditional_t<is_const, const T &, T &>;
+
+        /// Пустой конструктор
+        IncrementalIterator() noexcept = default;
+
+        /// Конструктор по вектору и индексу
+        /// \param owner Вектор
+        /// \param index Индекс элемента
+        IncrementalIterator(container *owner, std::ptrdiff_t index) noexcept: owner{owner}, index{index}{}
+
+        /// Преобразование iterator в const_iterator
+        /// \param other Неконстантный итератор
+        template <bool other_const>
+        IncrementalIterator(const IncrementalIterator<Container, T, other_const> &other) noexcept
+        requires (is_const && !other_const): owner{other.owner}, index{other.index}{}
+
+        reference operator*() const noexcept{ return (*owner)[static_cast<std::size_t>(index)]; }
+
+        pointer operator->() const noexcept{ return &**this; }
+
+        reference operator[](difference_type n) const noexcept{ return (*owner)[static_cast<std::size_t>(index + n)]; }
+
+        IncrementalIterator &operator++() noexcept{
+            ++index;
+            return *this;
+        }
+
+        IncrementalIterator operator++(int) noexcept{
+            IncrementalIterator tmp = *this;
+            ++index;
+            return tmp;
+        }
+
+        IncrementalIterator &operator--() noexcept{
+            --index;
+            return *this;
+        }
+
+        IncrementalIterator operator--(int) noexcept{
+            IncrementalIterator tmp = *this;
+            --index;
+            return tmp;
+        }
+
+        IncrementalIterator &operator+=(difference_type n) noexcept{
+            index += n;
+            return *this;
+        }
+
+        IncrementalIterator &operator-=(difference_type n) noexcept{
+            index -= n;
+            return *this;
+        }
+
+        friend IncrementalIterator operator+(IncrementalIterator it, difference_type n) noexcept{ return it += n; }
+
+        friend IncrementalIterator operator+(difference_type n, IncrementalIterator it) noexcept{ return it += n; }
+
+        friend IncrementalIterator operator-(IncrementalIterator it, difference_type n) noexcept{ return it -= n; }
+
+        friend difference_type operator-(const IncrementalIterator &a, const IncrementalIterator &b) noexcept{
+            return a.index - b.index;
+        }
+
+        bool operator==(const IncrementalIterator &other) const noexcept{ return index == other.index; }
+
+        auto operator<=>(const IncrementalIterator &other) const noexcept{ return index <=> other.index; }
+
+        friend class IncrementalIterator<Container, T, !is_const>;
+    };
+
+    /// Вектор с распределённым ростом: при заполнении выделяется новый блок, но элементы переносятся в него
+    /// не сразу, а по нескольку за каждое последующее добавление. Шаг переноса выбирается так,
+    /// чтобы перенос закончился до следующего роста, поэтому каждая операция выполняется за O(1) в худшем случае.
+    /// Во время переноса индексы [migrated, oldSize) указывают в старый блок, остальные - в новый
+    /// \tparam T Тип хранимых значений
+    /// \tparam Allocator Тип аллокатора
+    /// \tparam GrowthPolicy Политика роста ёмкости
+    template <typename T, typename Allocator = std::allocator<T>, growth_policy GrowthPolicy = doubling_growth>
+    class incremental_vector {
+    public:
+        /// Тип итератора
+        using iterator = IncrementalIterator<incremental_vector, T, false>;
+
+        /// Тип константного итератора
+        using const_iterator = IncrementalIterator<incremental_vector, T, true>;
+
+        /// Тип хранимых значений
+        using value_type = T;
+
+        /// Тип аллокатора
+        using allocator_type = Allocator;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Ссылка на тип хранимых значений
+        using reference = T &;
+
+        /// Константная ссылка на тип хранимых значений
+        using const_reference = const T &;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+    private:
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+        static constexpr bool relocatable = is_trivially_relocatable_v<T> && !std::uses_allocator_v<T, Allocator>;
+
+        [[no_unique_address]] Allocator alloc;
+        T *array = nullptr;
+        size_type _size = 0;
+        size_type _capacity = 0;
+
+        /// Старый блок и ещё не перенесённые из него элементы [migrated, oldSize)
+        T *old = nullptr;
+        size_type oldCapacity = 0;
+        size_type oldSize = 0;
+        size_type migrated = 0;
+        size_type step = 0;
+
+        [[nodiscard]] bool in_old(size_type index) const noexcept{ return index >= migrated && index < oldSize; }
+        void migrate(size_type count);
+        void start_migration(T *fresh, size_type newCapacity) noexcept;
+        void destroy_all() noexcept;
+        void release() noexcept;
+        void swap_storage(incremental_vector &second) noexcept;
+    public:
+        /// Пустой конструктор
+        incremental_vector() noexcept(noexcept(Allocator())) = default;
+
+        /// Конструктор по аллокатору
+        /// \param allocator Аллокатор
+        explicit incremental_vector(const Allocator &allocator) noexcept: alloc{allocator}{}
+
+        /// Конструктор по списку инициализации
+        /// \param list Список инициализации
+        /// \param allocator Аллокатор
+        incremental_vector(std::initializer_list<T> list, const Allocator &allocator = Allocator())
+        requires std::copy_constructible<T>;
+
+        /// Конструктор копирования; копия хранит все элементы в одном блоке
+        /// \param second Копируемый вектор
+        incremental_vector(const incremental_vector &second) requires std::copy_constructible<T>;
+
+        /// Конструктор перемещения
+        /// \param second Перемещаемый вектор
+        incremental_vector(incremental_vector &&second) noexcept;
+
+        /// Оператор присваивания копированием
+        /// \param second Копируемый вектор
+        /// \return Ссылка на текущий вектор
+        incremental_vector &operator=(const incremental_vector &second) requires std::copy_constructible<T>;
+
+        /// Оператор присваивания перемещением; при разных аллокаторах без propagate_on_container_move_assignment
+        /// элементы переносятся поштучно
+        /// \param second Перемещаемый вектор
+        /// \return Ссылка на текущий вектор
+        incremental_vector &operator=(incremental_vector &&second)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value);
+
+        /// Деструктор
+        ~incremental_vector();
+
+        /// Оператор доступа к элементу по индексу
+        /// \param index Индекс элемента
+        /// \return Ссылка на элемент
+        [[nodiscard]] T &operator[](size_type index) noexcept{ return in_old(index) ? old[index] : array[index]; }
+
+        /// Оператор доступа к элементу по индексу (константная версия)
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент
+        [[nodiscard]] const T &operator[](size_type index) const noexcept{
+            return in_old(index) ? old[index] : array[index];
+        }
+
+        /// Возвращает ссылку на элемент с проверкой индекса
+        /// \param index Индекс элемента
+        /// \return Ссылка на элемент
+        T &at(size_type index);
+
+        /// Возвращает ссылку на элемент с проверкой индекса (константная версия)
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент
+        const T &at(size_type index) const;
+
+        /// Возвращает ссылку на первый элемент
+        /// \return Ссылка на первый элемент
+        T &front() noexcept{ return (*this)[0]; }
+
+        /// Возвращает ссылку на последний элемент
+        /// \return Ссылка на последний элемент
+        T &back() noexcept{ return (*this)[_size - 1]; }
+
+        /// Возвращает размер вектора
+        /// \return Размер вектора
+        [[nodiscard]] size_type size() const noexcept{ return _size; }
+
+        /// Возвращает ёмкость нового блока
+        /// \return Ёмкость вектора
+        [[nodiscard]] size_type capacity() const noexcept{ return _capacity; }
+
+        /// Возвращает копию аллокатора вектора
+        /// \return Аллокатор
+        [[nodiscard]] allocator_type get_allocator() const noexcept{ return alloc; }
+
+        /// Проверяет, является ли вектор пустым
+        /// \return true, если размер вектора равен нулю
+        [[nodiscard]] bool empty() const noexcept{ return _size == 0; }
+
+        /// Проверяет, идёт ли перенос элементов из старого блока
+        /// \return true, если старый блок ещё не освобождён
+        [[nodiscard]] bool migrating() const noexcept{ return old != nullptr; }
+
+        /// Переносит все оставшиеся элементы старого блока и освобождает его
+        void finish_migration();
+
+        /// Возвращает указатель на непрерывные данные; завершает перенос
+        /// \return Указатель на первый элемент
+        T *data(){
+            finish_migration();
+            return array;
+        }
+
+        /// Резервирует ёмкость сразу, с полным переносом элементов (как vector::reserve)
+        /// \param newCapacity Новая ёмкость
+        void reserve(size_type newCapacity);
+
+        /// Добавляет элемент в конец вектора
+        /// \param element Значение элемента
+        void push_back(const T &element) requires std::copy_constructible<T>{ emplace_back(element); }
+
+        /// Добавляет элемент в конец вектора
+        /// \param element Значение элемента
+        void push_back(T &&element) requires std::move_constructible<T>{ emplace_back(std::move(element)); }
+
+        /// Конструирует элемент в конце вектора; при заполнении ёмкости начинает перенос в новый блок
+        /// \param args Аргументы конструктора
+        /// \return Ссылка на добавленный элемент
+        template <typename ...Args>
+        T &emplace_back(Args &&... args) requires std::constructible_from<T, Args...>;
+
+        /// Удаляет последний элемент
+        void pop_back() noexcept;
+
+        /// Удаляет все элементы; ёмкость нового блока сохраняется
+        void clear() noexcept;
+
+        /// Обменивает содержимое векторов
+        /// \param second Второй вектор
+        void swap(incremental_vector &second) noexcept;
+
+        /// Возвращает итератор на начало вектора
+        /// \return Итератор на начало
+        iterator begin() noexcept{ return iterator(this, 0); }
+
+        /// Возвращает итератор на конец вектора
+        /// \return Итератор на конец
+        iterator end() noexcept{ return iterator(this, static_cast<difference_type>(_size)); }
+
+        /// Возвращает константный итератор на начало вектора
+        /// \return Константный итератор на начало
+        const_iterator begin() const noexcept{ return const_iterator(this, 0); }
+
+        /// Возвращает константный итератор на конец вектора
+        /// \return Константный итератор на конец
+        const_iterator end() const noexcept{ return const_iterator(this, static_cast<difference_type>(_size)); }
+
+        /// Возвращает константный итератор на начало вектора
+        /// \return Константный итератор на начало
+        const_iterator cbegin() const noexcept{ return begin(); }
+
+        /// Возвращает константный итератор на конец вектора
+        /// \return Константный итератор на конец
+        const_iterator cend() const noexcept{ return end(); }
+    };
+}
+
+namespace MyVec {
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    incremental_vector<T, Allocator, GrowthPolicy>::incremental_vector(std::initializer_list<T> list,
+                                                                      const Allocator &allocator)
+    requires std::copy_constructible<T>: alloc{allocator}{
+        reserve(list.size());
+        for (const T &element: list){
+            emplace_back(element);
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    incremental_vector<T, Allocator, GrowthPolicy>::incremental_vector(const incremental_vector &second)
+    requires std::copy_constructible<T>: alloc{alloc_traits::select_on_container_copy_construction(second.alloc)}{
+        reserve(second._size);
+        for (const T &element: second){
+            emplace_back(element);
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    incremental_vector<T, Allocator, GrowthPolicy>::incremental_vector(incremental_vector &&second) noexcept
+            : alloc{std::move(second.alloc)}{
+        // swap() при propagate_on_container_swap вернул бы second уже забранный аллокатор
+        swap_storage(second);
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    incremental_vector<T, Allocator, GrowthPolicy> &
+    incremental_vector<T, Allocator, GrowthPolicy>::operator=(const incremental_vector &second)
+    requires std::copy_constructible<T>{
+        if (this != &second){
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value){
+                if (alloc != second.alloc){
+                    // Память текущего аллокатора не может быть освобождена новым
+                    release();
+                }
+                alloc = second.alloc;
+            }
+            clear();
+            reserve(second._size);
+            for (const T &element: second){
+                emplace_back(element);
+            }
+        }
+        return *this;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    incremental_vector<T, Allocator, GrowthPolicy> &
+    incremental_vector<T, Allocator, GrowthPolicy>::operator=(incremental_vector &&second)
+    noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value){
+        if (this == &second){
+            return *this;
+        }
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value){
+            release();
+            alloc = std::move(second.alloc);
+        } else if (alloc != second.alloc){
+            // Чужие блоки нельзя забрать: их освободит только аллокатор second
+            clear();
+            reserve(second._size);
+            for (T &element: second){
+                emplace_back(std::move(element));
+            }
+            second.clear();
+            return *this;
+        } else {
+            release();
+        }
+        swap_storage(second);
+        return *this;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    incremental_vector<T, Allocator, GrowthPolicy>::~incremental_vector(){
+        release();
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    void incremental_vector<T, Allocator, GrowthPolicy>::destroy_all() noexcept{
+        for (size_type i = 0; i < _size; i++){
+            alloc_traits::destroy(alloc, &(*this)[i]);
+        }
+        if (old){
+            alloc_traits::deallocate(alloc, old, oldCapacity);
+            old = nullptr;
+        }
+        _size = oldSize = migrated = oldCapacity = 0;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    void incremental_vector<T, Allocator, GrowthPolicy>::release() noexcept{
+        destroy_all();
+        if (array){
+            alloc_traits::deallocate(alloc, array, _capacity);
+            array = nullptr;
+        }
+        _capacity = step = 0;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    void incremental_vector<T, Allocator, GrowthPolicy>::migrate(size_type count){
+        size_type last = std::min(oldSize, migrated + count);
+        if constexpr (relocatable){
+            if (last > migrated){
+                std::memcpy(static_cast<void *>(array + migrated), static_cast<const void *>(old + migrated),
+                            (last - migrated) * sizeof(T));
+            }
+            migrated = last;
+        } else {
+            // Перенесённый элемент учитывается только после успешного конструирования: при исключении
+            // он остаётся в старом блоке
+            for (; migrated < last; migrated++){
+                alloc_traits::construct(alloc, &array[migrated], std::move_if_noexcept(old[migrated]));
+                alloc_traits::destroy(alloc, &old[migrated]);
+            }
+        }
+        if (migrated == oldSize){
+            // При первом росте старого блока нет
+            if (old){
+                alloc_traits::deallocate(alloc, old, oldCapacity);
+            }
+            old = nullptr;
+            oldCapacity = oldSize = migrated = 0;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    void incremental_vector<T, Allocator, GrowthPolicy>::start_migration(T *fresh, size_type newCapacity) noexcept{
+        old = array;
+        oldCapacity = _capacity;
+        oldSize = _size;
+        migrated = 0;
+        array = fresh;
+        _capacity = newCapacity;
+        // Ростом вызвано добавление ещё одного элемента, после него до следующего роста останется
+        // newCapacity - _size - 1 добавлений, за них нужно перенести oldSize элементов
+        size_type room = newCapacity > _size + 1 ? newCapacity - _size - 1 : 0;
+        step = room ? (oldSize + room - 1) / room : oldSize;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    void incremental_vector<T, Allocator, GrowthPolicy>::finish_migration(){
+        if (old){
+            migrate(oldSize);
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    T &incremental_vector<T, Allocator, GrowthPolicy>::at(size_type index){
+        if (index >= _size){
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    const T &incremental_vector<T, Allocator, GrowthPolicy>::at(size_type index) const{
+        if (index >= _size){
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    void incremental_vector<T, Allocator, GrowthPolicy>::reserve(size_type newCapacity){
+        finish_migration();
+        if (newCapacity <= _capacity){
+            return;
+        }
+        start_migration(alloc_traits::allocate(alloc, newCapacity), newCapacity);
+        try {
+            migrate(oldSize);
+        } catch (...){
+            // Возврат к старому блоку: перенесённые элементы уничтожаются, остальные остались на месте
+            for (size_type i = 0; i < migrated; i++){
+                alloc_traits::destroy(alloc, &array[i]);
+            }
+            alloc_traits::deallocate(alloc, array, _capacity);
+            array = old;
+            _capacity = oldCapacity;
+            old = nullptr;
+            oldCapacity = oldSize = migrated = 0;
+            throw;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    template <typename ...Args>
+    T &incremental_vector<T, Allocator, GrowthPolicy>::emplace_back(Args &&... args)
+    requires std::constructible_from<T, Args...>{
+        // Новый элемент конструируется до переноса: аргументы могут ссылаться на элементы старого блока
+        if (_size == _capacity){
+            // Шаг переноса гарантирует, что к моменту роста старый блок уже освобождён
+            finish_migration();
+            size_type newCapacity = GrowthPolicy::next_capacity(_capacity, _size + 1, sizeof(T));
+            T *fresh = alloc_traits::allocate(alloc, newCapacity);
+            try {
+                alloc_traits::construct(alloc, &fresh[_size], std::forward<Args>(args)...);
+            } catch (...){
+                alloc_traits::deallocate(alloc, fresh, newCapacity);
+                throw;
+            }
+            start_migration(fresh, newCapacity);
+            _size++;
+            if (oldSize == 0){
+                migrate(0);
+            }
+            return array[_size - 1];
+        }
+        alloc_traits::construct(alloc, &array[_size], std::forward<Args>(args)...);
+        if (old){
+            try {
+                migrate(step);
+            } catch (...){
+                alloc_traits::destroy(alloc, &array[_size]);
+                throw;
+            }
+        }
+        return array[_size++];
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    void incremental_vector<T, Allocator, GrowthPolicy>::pop_back() noexcept{
+        _size--;
+        alloc_traits::destroy(alloc, &(*this)[_size]);
+        if (_size < oldSize){
+            oldSize = _size;
+            if (migrated >= oldSize && old){
+                alloc_traits::deallocate(alloc, old, oldCapacity);
+                old = nullptr;
+                oldCapacity = oldSize = migrated = 0;
+            }
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    void incremental_vector<T, Allocator, GrowthPolicy>::clear() noexcept{
+        destroy_all();
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    void incremental_vector<T, Allocator, GrowthPolicy>::swap(incremental_vector &second) noexcept{
+        if constexpr (alloc_traits::propagate_on_container_swap::value){
+            std::swap(alloc, second.alloc);
+        }
+        swap_storage(second);
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy>
+    void incremental_vector<T, Allocator, GrowthPolicy>::swap_storage(incremental_vector &second) noexcept{
+        std::swap(array, second.array);
+        std::swap(_size, second._size);
+        std::swap(_capacity, second._capacity);
+        std::swap(old, second.old);
+        std::swap(oldCapacity, second.oldCapacity);
+        std::swap(oldSize, second.oldSize);
+        std::swap(migrated, second.migrated);
+        std::swap(step, second.step);
+    }
+}
+
+#endif
@@ -0,0 +1,711 @@
+#ifndef MYVEC_INPLACE_VECTOR_H
+#define MYVEC_INPLACE_VECTOR_H
+
+#include <new>
+#include "vector.h"
+
+namespace MyVec {
+    /// Вектор фиксированной ёмкости N, хранящий элементы внутри объекта (аналог std::inplace_vector из C++26).
+    /// Память в куче не выделяется никогда; добавление в заполненный вектор бросает std::bad_alloc,
+    /// try_-варианты возвращают nullptr, unchecked_-варианты не проверяют ёмкость.
+    /// Для тривиально копируемого T сам вектор тривиально копируем. Итераторы совпадают с vector
+    /// \tparam T Тип хранимых значений
+    /// \tparam N Ёмкость
+    template <typename T, std::size_t N>
+    class inplace_vector {
+        static_assert(N > 0, "inplace_vector requires a non-empty buffer");
+    public:
+        /// Тип итератора
+        using iterator = VectorIterator<T, false>;
+
+        /// Тип константного итератора
+        using const_iterator = VectorIterator<T, true>;
+
+        /// Тип хранимых значений
+        using value_type = T;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Тип указателя на хранимое значение
+        using pointer = T *;
+
+        /// Ссылка на тип хранимых значений
+        using reference = T &;
+
+        /// Константная ссылка на тип хранимых значений
+        using const_reference = const T &;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+    private:
+        alignas(T) std::byte storage[N * sizeof(T)];
+        size_type _size = 0;
+
+        static constexpr bool relocatable = is_trivially_relocatable_v<T>;
+
+        /// Специальные функции-члены тривиальны, если тривиальны соответствующие операции T
+        static constexpr bool trivial_copy = std::is_trivially_copy_constructible_v<T>;
+        static constexpr bool trivial_move = std::is_trivially_move_constructible_v<T>;
+        static constexpr bool trivial_destroy = std::is_trivially_destructible_v<T>;
+        static constexpr bool trivial_copy_assign =
+                trivial_copy && trivial_destroy && std::is_trivially_copy_assignable_v<T>;
+        static constexpr bool trivial_move_assign =
+                trivial_move && trivial_destroy && std::is_trivially_move_assignable_v<T>;
+
+        T *slots() noexcept{ return reinterpret_cast<T *>(storage); }
+        const T *slots() const noexcept{ return reinterpret_cast<const T *>(storage); }
+        static void check_room(size_type n);
+        template <typename It>
+        It append_n(It first, size_type n);
+        template <typename It>
+        void assign_n(It first, size_type n);
+        void erase_till_end(size_type from) noexcept;
+        void rotate_tail(size_type index, size_type n);
+    public:
+        /// Пустой конструктор, создаёт пустой вектор
+        inplace_vector() noexcept = default;
+
+        /// Конструктор, заполняющий вектор n копиями T()
+        /// \param size Количество элементов (не больше N, иначе std::bad_alloc)
+        explicit inplace_vector(size_type size) requires std::default_initializable<T>;
+
+        /// Конструктор, заполняющий вектор n копиями el
+        /// \param size Количество элементов (не больше N, иначе std::bad_alloc)
+        /// \param el Значение элемента, которым будет заполнен вектор
+        inplace_vector(size_type size, const T &el) requires std::copy_constructible<T>;
+
+        /// Конструктор, заполняющий вектор элементами из списка инициализации
+        /// \param list inisializer_list, из которого будут скопированы значения
+        inplace_vector(std::initializer_list<T> list) requires std::copy_constructible<T>;
+
+        /// Конструктор, заполняющий вектор элементами диапазона [first, last)
+        /// \param first Итератор на начало диапазона
+        /// \param last Конец диапазона
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires std::constructible_from<T, std::iter_reference_t<It>>
+        inplace_vector(It first, S last);
+
+        /// Конструктор, заполняющий вектор элементами диапазона
+        /// \param range Диапазон
+        template <std::ranges::input_range R>
+        requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+        inplace_vector(from_range_t, R &&range);
+
+        /// Копирующий конструктор (тривиальный для тривиально копируемого T)
+        /// \param second Другой вектор
+        inplace_vector(const inplace_vector &second) requires trivial_copy = default;
+
+        /// Копирующий конструктор
+        /// \param second Другой вектор
+        inplace_vector(const inplace_vector &second) requires (std::copy_constructible<T> && !trivial_copy);
+
+        /// Перемещающий конструктор (тривиальный для тривиально перемещаемого конструктором T)
+        /// \param second Другой вектор
+        inplace_vector(inplace_vector &&second) noexcept requires trivial_move = default;
+
+        /// Перемещающий конструктор. Элементы перемещаются поштучно, second сохраняет размер
+        /// и содержит перемещённые элементы
+        /// \param second Другой вектор
+        inplace_vector(inplace_vector &&second) noexcept(std::is_nothrow_move_constructible_v<T>)
+        requires (std::move_constructible<T> && !trivial_move);
+
+        /// Оператор присваивания копированием
+        /// \param second Другой вектор
+        /// \return Ссылка на текущий вектор после присваивания
+        inplace_vector &operator=(const inplace_vector &second) requires trivial_copy_assign = default;
+
+        /// Оператор присваивания копированием: живые элементы переприсваиваются, недостающие конструируются
+        /// \param second Другой вектор
+        /// \return Ссылка на текущий вектор после присваивания
+        inplace_vector &operator=(const inplace_vector &second)
+        requires (std::copy_constructible<T> && !trivial_copy_assign);
+
+        /// Оператор присваивания перемещением
+        /// \param second Другой вектор
+        /// \return Ссылка на текущий вектор после присваивания
+        inplace_vector &operator=(inplace_vector &&second) noexcept requires trivial_move_assign = default;
+
+        /// Оператор присваивания перемещением: элементы перемещаются поштучно, second сохраняет размер
+        /// \param second Другой вектор
+        /// \return Ссылка на текущий вектор после присваивания
+        inplace_vector &operator=(inplace_vector &&second)
+        noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+        requires (std::move_constructible<T> && !trivial_move_assign);
+
+        /// Оператор присваивания из списка инициализации
+        /// \param list inisializer_list, из которого будут скопированы значения
+        /// \return Ссылка на текущий вектор после присваивания
+        inplace_vector &operator=(std::initializer_list<T> list) requires std::copy_constructible<T>;
+
+        /// Деструктор (тривиальный для тривиально разрушаемого T)
+        ~inplace_vector() requires trivial_destroy = default;
+
+        /// Деструктор
+        ~inplace_vector(){ clear(); }
+
+        /// Заменяет содержимое вектора n копиями value
+        /// \param n Количество элементов (не больше N, иначе std::bad_alloc)
+        /// \param value Значение (может быть элементом самого вектора)
+        void assign(size_type n, const T &value) requires std::copy_constructible<T>;
+
+        /// Заменяет содержимое вектора элементами диапазона [first, last)
+        /// \param first Итератор на начало диапазона (не должен указывать внутрь вектора)
+        /// \param last Конец диапазона
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires std::constructible_from<T, std::iter_reference_t<It>>
+        void assign(It first, S last);
+
+        /// Оператор доступа к элементу вектора по индексу
+        /// \param index Индекс элемента
+        /// \return Ссылка на элемент вектора по указанному индексу
+        [[nodiscard]] T &operator[](size_type index){ return slots()[index]; }
+
+        /// Оператор доступа к элементу вектора по индексу (константная версия)
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент вектора по указанному индексу
+        [[nodiscard]] const T &operator[](size_type index) const{ return slots()[index]; }
+
+        /// Возвращает ссылку на элемент вектора по указанному индексу с проверкой границ
+        /// \param index Индекс элемента
+        /// \return Ссылка на элемент вектора по указанному индексу
+        [[nodiscard]] T &at(size_type index);
+
+        /// Возвращает константную ссылку на элемент вектора по указанному индексу с проверкой границ
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент вектора по указанному индексу
+        [[nodiscard]] const T &at(size_type index) const;
+
+        /// Возвращает ссылку на первый элемент вектора
+        /// \return Ссылка на первый элемент вектора
+        [[nodiscard]] T &front(){ return slots()[0]; }
+
+        /// Возвращает константную ссылку на первый элемент вектора
+        /// \return Константная ссылка на первый элемент вектора
+        [[nodiscard]] const T &front() const{ return slots()[0]; }
+
+        /// Возвращает ссылку на последний элемент вектора
+        /// \return Ссылка на последний элемент вектора
+        [[nodiscard]] T &back(){ return slots()[_size - 1]; }
+
+        /// Возвращает константную ссылку на последний элемент вектора
+        /// \return Константная ссылка на последний элемент вектора
+        [[nodiscard]] const T &back() const{ return slots()[_size - 1]; }
+
+        /// Возвращает указатель на начало массива вектора
+        /// \return Указатель на начало массива вектора
+        [[nodiscard]] T *data() noexcept{ return slots(); }
+
+        /// Возвращает указатель на начало массива вектора (константная версия)
+        /// \return Указатель на начало массива вектора
+        [[nodiscard]] const T *data() const noexcept{ return slots(); }
+
+        /// Возвращает размер вектора (количество элементов)
+        /// \return Размер вектора
+        [[nodiscard]] size_type size() const noexcept{ return _size; }
+
+        /// Возвращает ёмкость вектора
+        /// \return N
+        [[nodiscard]] static constexpr size_type capacity() noexcept{ return N; }
+
+        /// Возвращает максимальный размер вектора
+        /// \return N
+        [[nodiscard]] static constexpr size_type max_size() noexcept{ return N; }
+
+        /// Проверяет, является ли вектор пустым
+        /// \return true, если вектор пуст, иначе false
+        [[nodiscard]] bool empty() const noexcept{ return _size == 0; }
+
+        /// Проверяет, что вектор вмещает newCap элементов; память не выделяется
+        /// \param newCap Требуемая ёмкость (не больше N, иначе std::bad_alloc)
+        static void reserve(size_type newCap){ check_room(newCap); }
+
+        /// Изменяет размер вектора: лишние элементы разрушаются, новые инициализируются значением T()
+        /// \param newSize Новый размер (не больше N, иначе std::bad_alloc)
+        void resize(size_type newSize) requires std::default_initializable<T>;
+
+        /// Изменяет размер вектора: лишние элементы разрушаются, новые копируются из value
+        /// \param newSize Новый размер (не больше N, иначе std::bad_alloc)
+        /// \param value Значение новых элементов
+        void resize(size_type newSize, const T &value) requires std::copy_constructible<T>;
+
+        /// Копирует элемент в конец вектора
+        /// \param element Добавляемый элемент
+        void push_back(const T &element) requires std::copy_constructible<T>{ emplace_back(element); }
+
+        /// Перемещает элемент в конец вектора
+        /// \param element Добавляемый элемент
+        void push_back(T &&element) requires std::move_constructible<T>{ emplace_back(std::move(element)); }
+
+        /// Создает и добавляет элемент в конец вектора; в заполненном векторе бросает std::bad_alloc
+        /// \tparam Args Типы аргументов для конструирования элемента
+        /// \param args Аргументы для конструирования элемента
+        template <typename ...Args>
+        void emplace_back(Args &&... args) requires std::constructible_from<T, Args...>;
+
+        /// Копирует элемент в конец вектора, если есть место
+        /// \param element Добавляемый элемент
+        /// \return Указатель на добавленный элемент или nullptr, если вектор заполнен
+        T *try_push_back(const T &element) requires std::copy_constructible<T>{ return try_emplace_back(element); }
+
+        /// Перемещает элемент в конец вектора, если есть место; иначе element не изменяется
+        /// \param element Добавляемый элемент
+        /// \return Указатель на добавленный элемент или nullptr, если вектор заполнен
+        T *try_push_back(T &&element) requires std::move_constructible<T>{
+            return try_emplace_back(std::move(element));
+        }
+
+        /// Создает и добавляет элемент в конец вектора, если есть место
+        /// \tparam Args Типы аргументов для конструирования элемента
+        /// \param args Аргументы для конструирования элемента
+        /// \return Указатель на добавленный элемент или nullptr, если вектор заполнен
+        template <typename ...Args>
+        T *try_emplace_back(Args &&... args) requires std::constructible_from<T, Args...>;
+
+        /// Копирует элемент в конец вектора без проверки ёмкости
+        /// \param element Добавляемый элемент (вектор не должен быть заполнен)
+        /// \return Ссылка на добавленный элемент
+        T &unchecked_push_back(const T &element) requires std::copy_constructible<T>{
+            return unchecked_emplace_back(element);
+        }
+
+        /// Перемещает элемент в конец вектора без проверки ёмкости
+        /// \param element Добавляемый элемент (вектор не должен быть заполнен)
+        /// \return Ссылка на добавленный элемент
+        T &unchecked_push_back(T &&element) requires std::move_constructible<T>{
+            return unchecked_emplace_back(std::move(element));
+        }
+
+        /// Создает и добавляет элемент в конец вектора без проверки ёмкости
+        /// \tparam Args Типы аргументов для конструирования элемента
+        /// \param args Аргументы для конструирования элемента (вектор не должен быть заполнен)
+        /// \return Ссылка на добавленный элемент
+        template <typename ...Args>
+        T &unchecked_emplace_back(Args &&... args) requires std::constructible_from<T, Args...>;
+
+        /// Удаляет последний элемент вектора
+        void pop_back() noexcept{ std::destroy_at(slots() + --_size); }
+
+        /// Очищает вектор, вызывая деструктор хранимых объектов и устанавливая размер в 0
+        void clear() noexcept{ erase_till_end(0); }
+
+        /// Получение итератора на начало списка
+        /// \return Итератор, адресующий начало списка
+        iterator begin() noexcept{ return iterator(slots()); }
+
+        /// Получение итератора на конец списка
+        /// \return Итератор, адресующий конец списка
+        iterator end() noexcept{ return iterator(slots() + _size); }
+
+        /// Получение константного итератора на начало списка
+        /// \return Итератор, адресующий начало списка
+        const_iterator begin() const noexcept{ return const_iterator(const_cast<T *>(slots())); }
+
+        /// Получение константного итератора на конец списка
+        /// \return Итератор, адресующий конец списка
+        const_iterator end() const noexcept{ return const_iterator(const_cast<T *>(slots()) + _size); }
+
+        /// Получение константного итератора на начало списка
+        /// \return Итератор, адресующий начало списка
+        const_iterator cbegin() const noexcept{ return begin(); }
+
+        /// Получение константного итератора на конец списка
+        /// \return Итератор, адресующий конец списка
+        const_iterator cend() const noexcept{ return end(); }
+
+        /// Удаляет элемент из вектора по указанному итератору
+        /// \param it Итератор на удаляемый элемент
+        /// \return Итератор на элемент, следующий за удаленным элементом
+        iterator erase(iterator it) noexcept{ return erase(it, it + 1); }
+
+        /// Удаляет элементы в диапазоне [first, last) из вектора
+        /// \param first Итератор на начало диапазона
+        /// \param last Итератор на конец диапазона (не включая)
+        /// \return Итератор на элемент, следующий за последним удаленным элементом
+        iterator erase(iterator first, iterator last) noexcept;
+
+        /// Вставляет копию value перед pos
+        /// \param pos Итератор, перед которым вставляется элемент
+        /// \param value Значение (может быть элементом самого вектора)
+        /// \return Итератор на вставленный элемент
+        iterator insert(iterator pos, const T &value) requires std::copy_constructible<T>{ return emplace(pos, value); }
+
+        /// Вставляет value перемещением перед pos
+        /// \param pos Итератор, перед которым вставляется элемент
+        /// \param value Значение
+        /// \return Итератор на вставленный элемент
+        iterator insert(iterator pos, T &&value) requires std::move_constructible<T>{
+            return emplace(pos, std::move(value));
+        }
+
+        /// Конструирует элемент перед pos. Элемент конструируется в конце и сдвигается на место
+        /// (memmove для тривиально перемещаемых типов), поэтому аргументы могут ссылаться на элементы вектора
+        /// \tparam Args Типы аргументов для конструирования элемента
+        /// \param pos Итератор, перед которым вставляется элемент
+        /// \param args Аргументы для конструирования элемента
+        /// \return Итератор на вставленный элемент
+        template <typename ...Args>
+        requires std::constructible_from<T, Args...> && std::move_constructible<T>
+        iterator emplace(iterator pos, Args &&... args);
+
+        /// Вставляет n копий value перед pos
+        /// \param pos Итератор, перед которым вставляются элементы
+        /// \param n Количество элементов
+        /// \param value Значение (может быть элементом самого вектора)
+        /// \return Итератор на первый вставленный элемент
+        iterator insert(iterator pos, size_type n, const T &value) requires std::copy_constructible<T>;
+
+        /// Вставляет элементы диапазона [first, last) перед pos. Если места не хватает, бросает std::bad_alloc,
+        /// и вектор не изменяется
+        /// \param pos Итератор, перед которым вставляются элементы
+        /// \param first Итератор на начало диапазона
+        /// \param last Конец диапазона
+        /// \return Итератор на первый вставленный элемент
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires std::constructible_from<T, std::iter_reference_t<It>> && std::move_constructible<T>
+        iterator insert(iterator pos, It first, S last);
+
+        /// Обменивает содержимое двух векторов поэлементно
+        /// \param second Другой вектор
+        void swap(inplace_vector &second) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                   std::is_nothrow_swappable_v<T>);
+    };
+
+    template <typename T, std::size_t N>
+    struct is_trivially_relocatable<inplace_vector<T, N>> : is_trivially_relocatable<T> {};
+}
+
+namespace MyVec {
+    template <typename T, std::size_t N>
+    void inplace_vector<T, N>::check_room(size_type n){
+        if (n > N){
+            throw std::bad_alloc();
+        }
+    }
+
+    template <typename T, std::size_t N>
+    template <typename It>
+    It inplace_vector<T, N>::append_n(It first, size_type n){
+        // Ожидается, что место для n элементов проверено; при исключении вектор не изменяется
+        size_type i = 0;
+        try {
+            for (; i < n; ++i, ++first){
+                std::construct_at(slots() + _size + i, *first);
+            }
+        } catch (...){
+            std::destroy(slots() + _size, slots() + _size + i);
+            throw;
+        }
+        _size += n;
+        return first;
+    }
+
+    template <typename T, std::size_t N>
+    template <typename It>
+    void inplace_vector<T, N>::assign_n(It first, size_type n){
+        check_room(n);
+        size_type live = std::min(n, _size);
+        for (size_type i = 0; i < live; ++i, ++first){
+            slots()[i] = *first;
+        }
+        if (n > live){
+            append_n(std::move(first), n - live);
+        } else {
+            erase_till_end(n);
+        }
+    }
+
+    template <typename T, std::size_t N>
+    void inplace_vector<T, N>::erase_till_end(size_type from) noexcept{
+        std::destroy(slots() + from, slots() + _size);
+        _size = from;
+    }
+
+    template <typename T, std::size_t N>
+    void inplace_vector<T, N>::rotate_tail(size_type index, size_type n){
+        // Последние n элементов переставляются на позицию index
+        if (index + n == _size){
+            return;
+        }
+        if constexpr (relocatable){
+            if (n == 1){
+                alignas(T) std::byte tmp[sizeof(T)];
+                T *gap = slots() + index;
+                std::memcpy(static_cast<void *>(tmp), static_cast<const void *>(slots() + _size - 1), sizeof(T));
+                std::memmove(static_cast<void *>(gap + 1), static_cast<const void *>(gap),
+                             (_size - 1 - index) * sizeof(T));
+                std::memcpy(static_cast<void *>(gap), static_cast<const void *>(tmp), sizeof(T));
+                return;
+            }
+        }
+        std::rotate(slots() + index, slots() + _size - n, slots() + _size);
+    }
+
+    template <typename T, std::size_t N>
+    inplace_vector<T, N>::inplace_vector(size_type size) requires std::default_initializable<T>{
+        resize(size);
+    }
+
+    template <typename T, std::size_t N>
+    inplace_vector<T, N>::inplace_vector(size_type size, const T &el) requires std::copy_constructible<T>{
+        resize(size, el);
+    }
+
+    template <typename T, std::size_t N>
+    inplace_vector<T, N>::inplace_vector(std::initializer_list<T> list) requires std::copy_constructible<T>{
+        check_room(list.size());
+        append_n(list.begin(), list.size());
+    }
+
+    template <typename T, std::size_t N>
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    requires std::constructible_from<T, std::iter_reference_t<It>>
+    inplace_vector<T, N>::inplace_vector(It first, S last){
+        try {
+            assign(std::move(first), std::move(last));
+        } catch (...){
+            // Деструктор недостроенного объекта не вызывается
+            clear();
+            throw;
+        }
+    }
+
+    template <typename T, std::size_t N>
+    template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+    inplace_vector<T, N>::inplace_vector(from_range_t, R &&range){
+        try {
+            assign(std::ranges::begin(range), std::ranges::end(range));
+        } catch (...){
+            // Деструктор недостроенного объекта не вызывается
+            clear();
+            throw;
+        }
+    }
+
+    template <typename T, std::size_t N>
+    inplace_vector<T, N>::inplace_vector(const inplace_vector &second)
+    requires (std::copy_constructible<T> && !trivial_copy){
+        append_n(second.slots(), second._size);
+    }
+
+    template <typename T, std::size_t N>
+    inplace_vector<T, N>::inplace_vector(inplace_vector &&second) noexcept(std::is_nothrow_move_constructible_v<T>)
+    requires (std::move_constructible<T> && !trivial_move){
+        append_n(std::make_move_iterator(second.slots()), second._size);
+    }
+
+    template <typename T, std::size_t N>
+    inplace_vector<T, N> &inplace_vector<T, N>::operator=(const inplace_vector &second)
+    requires (std::copy_constructible<T> && !trivial_copy_assign){
+        if (this != &second){
+            assign_n(second.slots(), second._size);
+        }
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    inplace_vector<T, N> &inplace_vector<T, N>::operator=(inplace_vector &&second)
+    noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+    requires (std::move_constructible<T> && !trivial_move_assign){
+        if (this != &second){
+            assign_n(std::make_move_iterator(second.slots()), second._size);
+        }
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    inplace_vector<T, N> &inplace_vector<T, N>::operator=(std::initializer_list<T> list)
+    requires std::copy_constructible<T>{
+        assign_n(list.begin(), list.size());
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    void inplace_vector<T, N>::assign(size_type n, const T &value) requires std::copy_constructible<T>{
+        check_room(n);
+        // Элемент может быть уничтожен или перезаписан раньше, чем скопирован во все позиции
+        T copy(value);
+        size_type live = std::min(n, _size);
+        std::fill_n(slots(), live, copy);
+        if (n > live){
+            resize(n, copy);
+        } else {
+            erase_till_end(n);
+        }
+    }
+
+    template <typename T, std::size_t N>
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    requires std::constructible_from<T, std::iter_reference_t<It>>
+    void inplace_vector<T, N>::assign(It first, S last){
+        if constexpr (std::forward_iterator<It>){
+            assign_n(std::move(first), static_cast<size_type>(std::ranges::distance(first, last)));
+        } else {
+            size_type i = 0;
+            if constexpr (std::assignable_from<T &, std::iter_reference_t<It>>){
+                for (; i < _size && first != last; ++i, ++first){
+                    slots()[i] = *first;
+                }
+            }
+            erase_till_end(i);
+            for (; first != last; ++first){
+                emplace_back(*first);
+            }
+        }
+    }
+
+    template <typename T, std::size_t N>
+    T &inplace_vector<T, N>::at(size_type index){
+        if (index >= _size){
+            throw std::out_of_range("Index is out of range");
+        }
+        return slots()[index];
+    }
+
+    template <typename T, std::size_t N>
+    const T &inplace_vector<T, N>::at(size_type index) const{
+        if (index >= _size){
+            throw std::out_of_range("Index is out of range");
+        }
+        return slots()[index];
+    }
+
+    template <typename T, std::size_t N>
+    void inplace_vector<T, N>::resize(size_type newSize) requires std::default_initializable<T>{
+        check_room(newSize);
+        if (newSize <= _size){
+            erase_till_end(newSize);
+            return;
+        }
+        size_type oldSize = _size;
+        try {
+            for (; _size < newSize; _size++){
+                std::construct_at(slots() + _size);
+            }
+        } catch (...){
+            erase_till_end(oldSize);
+            throw;
+        }
+    }
+
+    template <typename T, std::size_t N>
+    void inplace_vector<T, N>::resize(size_type newSize, const T &value) requires std::copy_constructible<T>{
+        check_room(newSize);
+        if (newSize <= _size){
+            erase_till_end(newSize);
+            return;
+        }
+        // Существующие элементы не двигаются, поэтому value может быть элементом вектора
+        size_type oldSize = _size;
+        try {
+            for (; _size < newSize; _size++){
+                std::construct_at(slots() + _size, value);
+            }
+        } catch (...){
+            erase_till_end(oldSize);
+            throw;
+        }
+    }
+
+    template <typename T, std::size_t N>
+    template <typename ...Args>
+    void inplace_vector<T, N>::emplace_back(Args &&... args) requires std::constructible_from<T, Args...>{
+        if (_size == N){
+            throw std::bad_alloc();
+        }
+        unchecked_emplace_back(std::forward<Args>(args)...);
+    }
+
+    template <typename T, std::size_t N>
+    template <typename ...Args>
+    T *inplace_vector<T, N>::try_emplace_back(Args &&... args) requires std::constructible_from<T, Args...>{
+        if (_size == N){
+            return nullptr;
+        }
+        return &unchecked_emplace_back(std::forward<Args>(args)...);
+    }
+
+    template <typename T, std::size_t N>
+    template <typename ...Args>
+    T &inplace_vector<T, N>::unchecked_emplace_back(Args &&... args) requires std::constructible_from<T, Args...>{
+        T *element = std::construct_at(slots() + _size, std::forward<Args>(args)...);
+        _size++;
+        return *element;
+    }
+
+    template <typename T, std::size_t N>
+    iterator<T> inplace_vector<T, N>::erase(iterator first, iterator last) noexcept{
+        if (first == last){
+            return first;
+        }
+        if constexpr (relocatable){
+            std::destroy(&*first, &*last);
+            std::memmove(static_cast<void *>(&*first), static_cast<const void *>(&*last), (end() - last) * sizeof(T));
+            _size -= last - first;
+            return first;
+        }
+        std::move(last, end(), first);
+        erase_till_end(_size - (last - first));
+        return first;
+    }
+
+    template <typename T, std::size_t N>
+    template <typename ...Args>
+    requires std::constructible_from<T, Args...> && std::move_constructible<T>
+    iterator<T> inplace_vector<T, N>::emplace(iterator pos, Args &&... args){
+        size_type index = pos - begin();
+        emplace_back(std::forward<Args>(args)...);
+        rotate_tail(index, 1);
+        return begin() + index;
+    }
+
+    template <typename T, std::size_t N>
+    iterator<T> inplace_vector<T, N>::insert(iterator pos, size_type n, const T &value)
+    requires std::copy_constructible<T>{
+        size_type index = pos - begin();
+        resize(_size + n, value);
+        rotate_tail(index, n);
+        return begin() + index;
+    }
+
+    template <typename T, std::size_t N>
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    requires std::constructible_from<T, std::iter_reference_t<It>> && std::move_constructible<T>
+    iterator<T> inplace_vector<T, N>::insert(iterator pos, It first, S last){
+        size_type index = pos - begin();
+        size_type oldSize = _size;
+        if constexpr (std::forward_iterator<It> || std::sized_sentinel_for<S, It>){
+            size_type n = std::ranges::distance(first, last);
+            check_room(_size + n);
+            append_n(std::move(first), n);
+        } else {
+            try {
+                for (; first != last; ++first){
+                    emplace_back(*first);
+                }
+            } catch (...){
+                erase_till_end(oldSize);
+                throw;
+            }
+        }
+        rotate_tail(index, _size - oldSize);
+        return begin() + index;
+    }
+
+    template <typename T, std::size_t N>
+    void inplace_vector<T, N>::swap(inplace_vector &second) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                     std::is_nothrow_swappable_v<T>){
+        if (this == &second){
+            return;
+        }
+        inplace_vector &larger = _size >= second._size ? *this : second;
+        inplace_vector &smaller = _size >= second._size ? second : *this;
+        size_type common = smaller._size;
+        std::swap_ranges(larger.slots(), larger.slots() + common, smaller.slots());
+        smaller.append_n(std::make_move_iterator(larger.slots() + common), larger._size - common);
+        larger.erase_till_end(common);
+    }
+}
+
+#endif
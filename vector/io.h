@@ -0,0 +1,554 @@
+#ifndef MYVEC_IO_H
+#define MYVEC_IO_H
+
+#include <bit>
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "vector.h"
+
+/// Снимки векторов в файлах: заголовок с описанием формата и данные.
+/// Тривиальные типы записываются одним pwritev и читаются pread сразу в память вектора,
+/// остальные кодируются потоково кусками фиксированного размера через codec<T>
+namespace MyVec::io {
+    /// Текущая версия формата
+    inline constexpr std::uint32_t format_version = 1;
+
+    /// Флаги заголовка
+    enum header_flags : std::uint32_t {
+        /// Данные - байты элементов подряд (тривиально копируемый T), иначе - поток codec<T>
+        raw = 1,
+        /// Снимок записан на машине с обратным порядком байт (big-endian)
+        big_endian = 2
+    };
+
+    /// Заголовок снимка. Поля записываются в порядке байт машины, порядок отмечается флагом big_endian
+    struct header {
+        char magic[8] = {'M', 'Y', 'V', 'E', 'C', 'S', 'N', 'P'};
+        std::uint32_t version = format_version;
+        std::uint32_t flags = 0;
+        std::uint32_t element_size = 0;
+        std::uint32_t element_alignment = 0;
+        std::uint64_t count = 0;
+        /// Размер данных после заголовка в байтах
+        std::uint64_t payload_bytes = 0;
+        /// Контрольная сумма данных (см. checksum)
+        std::uint64_t checksum = 0;
+    };
+
+    static_assert(sizeof(header) == 48 && std::is_trivially_copyable_v<header>);
+
+    /// Ошибка формата: чужой или повреждённый файл, несовпадение типа, версии или порядка байт
+    class format_error : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /// Инкрементальная контрольная сумма: FNV-1a по 64-битным словам, хвост короче слова дополняется нулями.
+    /// Результат не зависит от того, какими кусками подаются данные
+    class checksum {
+    private:
+        static constexpr std::uint64_t prime = 0x100000001b3;
+        std::uint64_t state = 0xcbf29ce484222325;
+        unsigned char tail[8]{};
+        std::size_t tailSize = 0;
+
+        void mix(std::uint64_t word) noexcept{ state = (state ^ word) * prime; }
+    public:
+        /// Добавляет данные
+        /// \param data Указатель на данные
+        /// \param n Размер в байтах
+        void update(const void *data, std::size_t n) noexcept;
+
+        /// Возвращает сумму всех добавленных данных
+        /// \return Контрольная сумма
+        [[nodiscard]] std::uint64_t value() const noexcept;
+    };
+
+    /// Буферизованная запись в файловый дескриптор с заданного смещения через pwrite.
+    /// Считает размер и контрольную сумму записанного
+    class encoder {
+    private:
+        int fd;
+        off_t offset;
+        MyVec::vector<unsigned char> buffer;
+        std::size_t used = 0;
+        std::uint64_t written = 0;
+        checksum sum;
+    public:
+        /// \param fd Файловый дескриптор
+        /// \param offset Смещение, с которого начинается запись
+        /// \param chunk Размер буфера в байтах
+        encoder(int fd, off_t offset, std::size_t chunk = std::size_t{1} << 20);
+
+        /// Записывает байты
+        /// \param data Указатель на данные
+        /// \param n Размер в байтах
+        void write(const void *data, std::size_t n);
+
+        /// Записывает значение тривиально копируемого типа
+        /// \param value Значение
+        template <typename U>
+        requires std::is_trivially_copyable_v<U>
+        void put(const U &value){ write(&value, sizeof(U)); }
+
+        /// Сбрасывает буфер в файл
+        void flush();
+
+        /// Количество записанных байт
+        [[nodiscard]] std::uint64_t bytes() const noexcept{ return written; }
+
+        /// Контрольная сумма записанных байт
+        [[nodiscard]] std::uint64_t digest() const noexcept{ return sum.value(); }
+    };
+
+    /// Буферизованное чтение из файлового дескриптора через pread, не дальше limit байт от начального смещения.
+    /// Большие чтения идут сразу в память получателя
+    class decoder {
+    private:
+        int fd;
+        off_t offset;
+        std::uint64_t left;
+        MyVec::vector<unsigned char> buffer;
+        std::size_t position = 0;
+        checksum sum;
+
+        void fill();
+    public:
+        /// \param fd Файловый дескриптор
+        /// \param offset Смещение, с которого начинается чтение
+        /// \param limit Количество байт, доступных для чтения
+        /// \param chunk Размер буфера в байтах
+        decoder(int fd, off_t offset, std::uint64_t limit, std::size_t chunk = std::size_t{1} << 20);
+
+        /// Читает байты
+        /// \param data Куда читать
+        /// \param n Размер в байтах
+        void read(void *data, std::size_t n);
+
+        /// Читает значение тривиально копируемого типа
+        /// \return Значение
+        template <typename U>
+        requires std::is_trivially_copyable_v<U>
+        U get(){
+            alignas(U) unsigned char bytes[sizeof(U)];
+            read(bytes, sizeof(U));
+            return std::bit_cast<U>(bytes);
+        }
+
+        /// Проверяет, прочитаны ли все данные
+        [[nodiscard]] bool exhausted() const noexcept{ return left == 0 && position == buffer.size(); }
+
+        /// Количество байт, которые ещё можно прочитать
+        [[nodiscard]] std::uint64_t remaining() const noexcept{ return left + (buffer.size() - position); }
+
+        /// Контрольная сумма прочитанных байт
+        [[nodiscard]] std::uint64_t digest() const noexcept{ return sum.value(); }
+    };
+
+    /// Кодек элемента для потокового формата: статические encode(const T&, encoder&) и decode(decoder&) -> T.
+    /// Специализации есть для тривиально копируемых типов и std::basic_string, для своих типов её нужно определить
+    /// \tparam T Тип элемента
+    template <typename T>
+    struct codec;
+
+    template <typename T>
+    requires std::is_trivially_copyable_v<T>
+    struct codec<T> {
+        static void encode(const T &value, encoder &out){ out.put(value); }
+        static T decode(decoder &in){ return in.get<T>(); }
+    };
+
+    template <typename Char, typename Traits, typename Allocator>
+    struct codec<std::basic_string<Char, Traits, Allocator>> {
+        static void encode(const std::basic_string<Char, Traits, Allocator> &value, encoder &out){
+            out.put(std::uint64_t{value.size()});
+            out.write(value.data(), value.size() * sizeof(Char));
+        }
+
+        static std::basic_string<Char, Traits, Allocator> decode(decoder &in){
+            // Длина из файла проверяется до выделения памяти под строку
+            auto length = in.get<std::uint64_t>();
+            if (length > in.remaining() / sizeof(Char)){
+                throw format_error("MyVec::io: string length exceeds the snapshot size");
+            }
+            std::basic_string<Char, Traits, Allocator> value(static_cast<std::size_t>(length), Char());
+            in.read(value.data(), value.size() * sizeof(Char));
+            return value;
+        }
+    };
+
+    /// Тип с кодеком для потокового формата
+    template <typename T>
+    concept encodable = requires(const T &value, encoder &out, decoder &in){
+        codec<T>::encode(value, out);
+        { codec<T>::decode(in) } -> std::convertible_to<T>;
+    };
+
+    /// Тип, который записывается и читается байтами напрямую из памяти вектора
+    template <typename T>
+    concept bulk = std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T> &&
+                   std::is_trivially_destructible_v<T>;
+
+    /// Записывает снимок вектора с текущего смещения fd; после записи смещение указывает на конец снимка
+    /// \param fd Файловый дескриптор, открытый на запись (для потокового формата - с возможностью pwrite)
+    /// \param v Вектор
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    requires bulk<T> || encodable<T>
+    void save(int fd, const vector<T, Allocator, GrowthPolicy, Telemetry> &v);
+
+    /// Записывает снимок вектора в файл, заменяя его содержимое
+    /// \param path Путь к файлу
+    /// \param v Вектор
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    requires bulk<T> || encodable<T>
+    void save(const std::string &path, const vector<T, Allocator, GrowthPolicy, Telemetry> &v);
+
+    /// Читает снимок с текущего смещения fd и заменяет им содержимое вектора. Память под все элементы
+    /// резервируется заранее; при ошибке вектор не меняется
+    /// \param fd Файловый дескриптор, открытый на чтение
+    /// \param v Вектор
+    /// \param verify Проверять контрольную сумму
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    requires bulk<T> || encodable<T>
+    void load(int fd, vector<T, Allocator, GrowthPolicy, Telemetry> &v, bool verify = true);
+
+    /// Читает снимок из файла и заменяет им содержимое вектора
+    /// \param path Путь к файлу
+    /// \param v Вектор
+    /// \param verify Проверять контрольную сумму
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    requires bulk<T> || encodable<T>
+    void load(const std::string &path, vector<T, Allocator, GrowthPolicy, Telemetry> &v, bool verify = true);
+
+    /// Читает снимок из файла
+    /// \tparam Vector Тип вектора
+    /// \param path Путь к файлу
+    /// \param verify Проверять контрольную сумму
+    /// \return Вектор
+    template <typename Vector>
+    Vector load(const std::string &path, bool verify = true){
+        Vector v;
+        load(path, v, verify);
+        return v;
+    }
+}
+
+namespace MyVec::io {
+    namespace detail {
+        [[noreturn]] inline void fail(const char *what){
+            throw std::system_error(errno, std::generic_category(), what);
+        }
+
+        /// Записывает все iovec начиная с offset, продолжая после частичных записей
+        inline void write_all(int fd, off_t offset, iovec *parts, int count){
+            while (count > 0){
+                ssize_t n = ::pwritev(fd, parts, count, offset);
+                if (n < 0){
+                    if (errno == EINTR){
+                        continue;
+                    }
+                    fail("MyVec::io: write failed");
+                }
+                offset += n;
+                auto done = static_cast<std::size_t>(n);
+                for (; count > 0 && done >= parts->iov_len; count--, parts++){
+                    done -= parts->iov_len;
+                }
+                if (count > 0){
+                    parts->iov_base = static_cast<char *>(parts->iov_base) + done;
+                    parts->iov_len -= done;
+                }
+            }
+        }
+
+        /// Читает ровно n байт начиная с offset
+        inline void read_all(int fd, off_t offset, void *data, std::size_t n){
+            auto *p = static_cast<char *>(data);
+            while (n > 0){
+                ssize_t r = ::pread(fd, p, n, offset);
+                if (r < 0){
+                    if (errno == EINTR){
+                        continue;
+                    }
+                    fail("MyVec::io: read failed");
+                }
+                if (r == 0){
+                    throw format_error("MyVec::io: snapshot is truncated");
+                }
+                p += r;
+                n -= static_cast<std::size_t>(r);
+                offset += r;
+            }
+        }
+
+        inline off_t position(int fd){
+            off_t offset = ::lseek(fd, 0, SEEK_CUR);
+            if (offset < 0){
+                fail("MyVec::io: lseek failed");
+            }
+            return offset;
+        }
+
+        inline constexpr std::uint32_t native_order = std::endian::native == std::endian::big ? std::uint32_t{big_endian} : 0;
+
+        template <typename T>
+        header make_header(std::uint64_t count){
+            header h;
+            h.flags = (bulk<T> ? std::uint32_t{raw} : 0) | native_order;
+            h.element_size = sizeof(T);
+            h.element_alignment = alignof(T);
+            h.count = count;
+            return h;
+        }
+
+        template <typename T>
+        header read_header(int fd, off_t offset){
+            header h;
+            read_all(fd, offset, &h, sizeof(h));
+            if (std::string_view(h.magic, sizeof(h.magic)) != std::string_view(header().magic, sizeof(h.magic))){
+                throw format_error("MyVec::io: not a vector snapshot");
+            }
+            if (h.version > format_version){
+                throw format_error("MyVec::io: unsupported snapshot version " + std::to_string(h.version));
+            }
+            if ((h.flags & big_endian) != native_order){
+                throw format_error("MyVec::io: snapshot was written with a different byte order");
+            }
+            if (h.element_size != sizeof(T) || h.element_alignment != alignof(T) ||
+                static_cast<bool>(h.flags & raw) != bulk<T>){
+                throw format_error("MyVec::io: snapshot element type does not match");
+            }
+            // Поля заголовка проверяются по реальному размеру файла до того, как по ним выделяется память
+            struct stat st{};
+            if (::fstat(fd, &st) != 0){
+                fail("MyVec::io: cannot stat file");
+            }
+            if (S_ISREG(st.st_mode)){
+                off_t available = st.st_size - offset - static_cast<off_t>(sizeof(h));
+                if (available < 0 || h.payload_bytes > static_cast<std::uint64_t>(available)){
+                    throw format_error("MyVec::io: snapshot is truncated");
+                }
+            }
+            if (bulk<T> && (h.count > std::numeric_limits<std::uint64_t>::max() / sizeof(T) ||
+                            h.payload_bytes != h.count * sizeof(T))){
+                throw format_error("MyVec::io: snapshot size does not match the element count");
+            }
+            return h;
+        }
+
+        /// Закрывает дескриптор при выходе из области видимости
+        struct file {
+            int fd;
+            ~file(){ ::close(fd); }
+        };
+    }
+
+    inline void checksum::update(const void *data, std::size_t n) noexcept{
+        auto *p = static_cast<const unsigned char *>(data);
+        if (tailSize){
+            std::size_t take = std::min(n, sizeof(tail) - tailSize);
+            std::memcpy(tail + tailSize, p, take);
+            tailSize += take;
+            p += take;
+            n -= take;
+            if (tailSize < sizeof(tail)){
+                return;
+            }
+            std::uint64_t word;
+            std::memcpy(&word, tail, sizeof(word));
+            mix(word);
+            tailSize = 0;
+        }
+        for (; n >= sizeof(std::uint64_t); p += sizeof(std::uint64_t), n -= sizeof(std::uint64_t)){
+            std::uint64_t word;
+            std::memcpy(&word, p, sizeof(word));
+            mix(word);
+        }
+        std::memcpy(tail, p, n);
+        tailSize = n;
+    }
+
+    inline std::uint64_t checksum::value() const noexcept{
+        if (!tailSize){
+            return state;
+        }
+        std::uint64_t word = 0;
+        std::memcpy(&word, tail, tailSize);
+        return (state ^ word) * prime;
+    }
+
+    inline encoder::encoder(int fd, off_t offset, std::size_t chunk): fd{fd}, offset{offset}{
+        buffer.resize_for_overwrite(chunk);
+    }
+
+    inline void encoder::write(const void *data, std::size_t n){
+        sum.update(data, n);
+        written += n;
+        auto *p = static_cast<const unsigned char *>(data);
+        if (n >= buffer.size()){
+            flush();
+            iovec part{const_cast<unsigned char *>(p), n};
+            detail::write_all(fd, offset, &part, 1);
+            offset += static_cast<off_t>(n);
+            return;
+        }
+        if (used + n > buffer.size()){
+            flush();
+        }
+        std::memcpy(buffer.data() + used, p, n);
+        used += n;
+    }
+
+    inline void encoder::flush(){
+        if (used){
+            iovec part{buffer.data(), used};
+            detail::write_all(fd, offset, &part, 1);
+            offset += static_cast<off_t>(used);
+            used = 0;
+        }
+    }
+
+    inline decoder::decoder(int fd, off_t offset, std::uint64_t limit, std::size_t chunk)
+            : fd{fd}, offset{offset}, left{limit}{
+        buffer.reserve(chunk);
+    }
+
+    inline void decoder::fill(){
+        if (left == 0){
+            throw format_error("MyVec::io: snapshot is truncated");
+        }
+        std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(left, buffer.capacity()));
+        buffer.resize_for_overwrite(n);
+        detail::read_all(fd, offset, buffer.data(), n);
+        offset += static_cast<off_t>(n);
+        left -= n;
+        position = 0;
+    }
+
+    inline void decoder::read(void *data, std::size_t n){
+        auto *p = static_cast<unsigned char *>(data);
+        std::size_t buffered = std::min(n, buffer.size() - position);
+        std::memcpy(p, buffer.data() + position, buffered);
+        position += buffered;
+        p += buffered;
+        n -= buffered;
+        if (n >= buffer.capacity()){
+            if (n > left){
+                throw format_error("MyVec::io: snapshot is truncated");
+            }
+            detail::read_all(fd, offset, p, n);
+            offset += static_cast<off_t>(n);
+            left -= n;
+            sum.update(data, buffered + n);
+            return;
+        }
+        while (n > 0){
+            fill();
+            std::size_t take = std::min(n, buffer.size());
+            std::memcpy(p, buffer.data(), take);
+            position = take;
+            p += take;
+            n -= take;
+        }
+        sum.update(data, static_cast<std::size_t>(p - static_cast<unsigned char *>(data)));
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    requires bulk<T> || encodable<T>
+    void save(int fd, const vector<T, Allocator, GrowthPolicy, Telemetry> &v){
+        off_t start = detail::position(fd);
+        header h = detail::make_header<T>(v.size());
+        if constexpr (bulk<T>){
+            h.payload_bytes = v.size() * sizeof(T);
+            checksum sum;
+            sum.update(v.data(), h.payload_bytes);
+            h.checksum = sum.value();
+            iovec parts[2] = {{&h, sizeof(h)}, {const_cast<T *>(v.data()), h.payload_bytes}};
+            detail::write_all(fd, start, parts, 2);
+        } else {
+            encoder out(fd, start + static_cast<off_t>(sizeof(h)));
+            for (const T &element: v){
+                codec<T>::encode(element, out);
+            }
+            out.flush();
+            h.payload_bytes = out.bytes();
+            h.checksum = out.digest();
+            // Размер данных и сумма известны только после кодирования, поэтому заголовок пишется последним
+            iovec part{&h, sizeof(h)};
+            detail::write_all(fd, start, &part, 1);
+        }
+        if (::lseek(fd, start + static_cast<off_t>(sizeof(h) + h.payload_bytes), SEEK_SET) < 0){
+            detail::fail("MyVec::io: lseek failed");
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    requires bulk<T> || encodable<T>
+    void save(const std::string &path, const vector<T, Allocator, GrowthPolicy, Telemetry> &v){
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0){
+            detail::fail("MyVec::io: cannot open file");
+        }
+        detail::file guard{fd};
+        save(fd, v);
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    requires bulk<T> || encodable<T>
+    void load(int fd, vector<T, Allocator, GrowthPolicy, Telemetry> &v, bool verify){
+        off_t start = detail::position(fd);
+        header h = detail::read_header<T>(fd, start);
+        off_t payload = start + static_cast<off_t>(sizeof(h));
+        vector<T, Allocator, GrowthPolicy, Telemetry> result(v.get_allocator());
+        std::uint64_t digest = 0;
+        if constexpr (bulk<T>){
+            std::span<T> window = result.append_window(h.count);
+            detail::read_all(fd, payload, window.data(), h.payload_bytes);
+            result.commit_append(h.count);
+            if (verify){
+                checksum sum;
+                sum.update(result.data(), h.payload_bytes);
+                digest = sum.value();
+            }
+        } else {
+            decoder in(fd, payload, h.payload_bytes);
+            // Кодек может записывать элемент меньше чем одним байтом, поэтому count проверить нельзя;
+            // резерв ограничен размером данных, дальше вектор растёт как обычно
+            result.reserve(static_cast<std::size_t>(std::min(h.count, h.payload_bytes)));
+            for (std::uint64_t i = 0; i < h.count; i++){
+                result.emplace_back(codec<T>::decode(in));
+            }
+            if (!in.exhausted()){
+                throw format_error("MyVec::io: snapshot has trailing data");
+            }
+            digest = in.digest();
+        }
+        if (verify && digest != h.checksum){
+            throw format_error("MyVec::io: snapshot checksum mismatch");
+        }
+        if (::lseek(fd, payload + static_cast<off_t>(h.payload_bytes), SEEK_SET) < 0){
+            detail::fail("MyVec::io: lseek failed");
+        }
+        v.swap(result);
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    requires bulk<T> || encodable<T>
+    void load(const std::string &path, vector<T, Allocator, GrowthPolicy, Telemetry> &v, bool verify){
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0){
+            detail::fail("MyVec::io: cannot open file");
+        }
+        detail::file guard{fd};
+        load(fd, v, verify);
+    }
+}
+
+#endif
@@ -0,0 +1,560 @@
+#ifndef MYVEC_MMAP_VECTOR_H
+#define MYVEC_MMAP_VECTOR_H
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "vector.h"
+
+namespace MyVec {
+    /// Режим открытия файла mmap_vector
+    enum class mmap_mode {
+        /// Файл только читается: отображение закрытое (MAP_PRIVATE), изменения элементов не попадают в файл,
+        /// операции, меняющие размер, бросают std::logic_error
+        read_only,
+        /// Файл открывается или создаётся на чтение и запись, изменения попадают в файл (MAP_SHARED)
+        read_write
+    };
+
+    /// Подсказки ядру о порядке доступа к отображению (madvise)
+    enum class mmap_advice {
+        normal,
+        sequential,
+        random,
+        willneed,
+        dontneed,
+        hugepage
+    };
+
+    /// Вектор тривиально копируемых значений, хранящихся в файле, отображённом в память.
+    /// Файл - массив значений без заголовка, размер вектора - размер файла, делённый на sizeof(T).
+    /// Открытие не читает файл: страницы подгружаются при первом обращении.
+    /// В режиме read_write ёмкость растёт через ftruncate + mremap, а при закрытии файл обрезается до размера вектора.
+    /// Интерфейс - подмножество vector: доступ, push_back/emplace_back, resize, reserve, assign, insert/emplace в позицию
+    /// и erase; нет аллокатора, копирования, unordered_erase/swap_remove/retain, операций *_range, append_window
+    /// и параллельных операций
+    /// \tparam T Тип хранимых значений
+    /// \tparam GrowthPolicy Политика роста ёмкости при добавлении в заполненный вектор
+    template <typename T, growth_policy GrowthPolicy = doubling_growth>
+    class mmap_vector {
+        static_assert(std::is_trivially_copyable_v<T>, "mmap_vector requires a trivially copyable type");
+    public:
+        /// Тип итератора
+        using iterator = VectorIterator<T, false>;
+
+        /// Тип константного итератора
+        using const_iterator = VectorIterator<T, true>;
+
+        /// Тип хранимых значений
+        using value_type = T;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Тип указателя на хранимое значение
+        using pointer = T *;
+
+        /// Ссылка на тип хранимых значений
+        using reference = T &;
+
+        /// Константная ссылка на тип хранимых значений
+        using const_reference = const T &;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+    private:
+        size_type _size = 0;
+        size_type _capacity = 0;
+        T *array = nullptr;
+        size_type mapped = 0;
+        int fd = -1;
+        mmap_mode mode = mmap_mode::read_only;
+        mmap_advice advice = mmap_advice::normal;
+
+        static size_type page_round(size_type bytes) noexcept;
+        [[noreturn]] static void fail(const char *what);
+        void require_writable() const;
+        void remap(size_type newCap);
+        void grow_to(size_type required);
+        void close() noexcept;
+    public:
+        /// Пустой конструктор, создаёт вектор без файла
+        mmap_vector() noexcept = default;
+
+        /// Конструктор, отображающий файл в память
+        /// \param path Путь к файлу
+        /// \param mode Режим открытия; read_write создаёт файл, если его нет
+        explicit mmap_vector(const std::string &path, mmap_mode mode = mmap_mode::read_only);
+
+        mmap_vector(const mmap_vector &) = delete;
+        mmap_vector &operator=(const mmap_vector &) = delete;
+
+        /// Перемещающий конструктор
+        /// \param second Другой вектор
+        mmap_vector(mmap_vector &&second) noexcept{ swap(second); }
+
+        /// Оператор присваивания перемещением
+        /// \param second Другой вектор
+        /// \return Ссылка на текущий вектор после присваивания
+        mmap_vector &operator=(mmap_vector &&second) noexcept{
+            if (this != &second){
+                close();
+                swap(second);
+            }
+            return *this;
+        }
+
+        /// Деструктор. Снимает отображение, обрезает файл до размера вектора и закрывает его
+        ~mmap_vector(){ close(); }
+
+        /// Оператор доступа к элементу вектора по индексу
+        /// \param index Индекс элемента
+        /// \return Ссылка на элемент вектора по указанному индексу
+        [[nodiscard]] T &operator[](size_type index){ return array[index]; };
+
+        /// Оператор доступа к элементу вектора по индексу (константная версия)
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент вектора по указанному индексу
+        [[nodiscard]] const T &operator[](size_type index) const{ return array[index]; };
+
+        /// Возвращает размер вектора (количество элементов)
+        /// \return Размер вектора
+        [[nodiscard]] size_type size() const noexcept{ return _size; };
+
+        /// Возвращает текущую ёмкость вектора
+        /// \return Текущая ёмкость вектора
+        [[nodiscard]] size_type capacity() const noexcept{ return _capacity; };
+
+        /// Проверяет, является ли вектор пустым
+        /// \return true, если вектор пуст, иначе false
+        [[nodiscard]] bool empty() const noexcept{ return _size == 0; };
+
+        /// Проверяет, открыт ли файл только для чтения
+        /// \return true в режиме read_only
+        [[nodiscard]] bool read_only() const noexcept{ return mode == mmap_mode::read_only; }
+
+        /// Увеличивает ёмкость вектора до указанной величины, расширяя файл
+        /// \param newCap Новая ёмкость вектора
+        void reserve(size_type newCap);
+
+        /// Изменяет размер вектора, новые элементы инициализируются значением T()
+        /// \param newSize Новый размер
+        void resize(size_type newSize);
+
+        /// Изменяет размер вектора, новые элементы копируются из value
+        /// \param newSize Новый размер
+        /// \param value Значение новых элементов
+        void resize(size_type newSize, const T &value);
+
+        /// Возвращает ссылку на элемент с проверкой индекса
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент
+        const T &at(size_type index) const;
+
+        /// Возвращает ссылку на элемент с проверкой индекса
+        /// \param index Индекс элемента
+        /// \return Ссылка на элемент
+        T &at(size_type index);
+
+        /// Возвращает ссылку на первый элемент
+        /// \return Ссылка на первый элемент
+        T &front(){ return array[0]; }
+
+        /// Возвращает ссылку на первый элемент (константная версия)
+        /// \return Константная ссылка на первый элемент
+        const T &front() const{ return array[0]; }
+
+        /// Возвращает ссылку на последний элемент
+        /// \return Ссылка на последний элемент
+        T &back(){ return array[_size - 1]; }
+
+        /// Возвращает ссылку на последний элемент (константная версия)
+        /// \return Константная ссылка на последний элемент
+        const T &back() const{ return array[_size - 1]; }
+
+        /// Возвращает указатель на отображённые данные
+        /// \return Указатель на первый элемент
+        T *data() noexcept{ return array; }
+
+        /// Возвращает указатель на отображённые данные (константная версия)
+        /// \return Указатель на первый элемент
+        const T *data() const noexcept{ return array; }
+
+        /// Добавляет элемент в конец вектора
+        /// \param element Значение элемента
+        void push_back(const T &element);
+
+        /// Конструирует элемент в конце вектора
+        /// \tparam Args Типы аргументов конструктора
+        /// \param args Аргументы конструктора
+        template <typename ...Args>
+        void emplace_back(Args &&... args) requires std::constructible_from<T, Args...>;
+
+        /// Очищает вектор; ёмкость (и длина файла до закрытия) сохраняется
+        void clear();
+
+        /// Удаляет элемент; erase(end()) ничего не делает
+        /// \param it Итератор на удаляемый элемент
+        /// \return Итератор на элемент, следующий за удалённым
+        iterator erase(iterator it);
+
+        /// Удаляет элементы из диапазона [first, last)
+        /// \param first Начало диапазона
+        /// \param last Конец диапазона
+        /// \return Итератор на элемент, следующий за удалёнными
+        iterator erase(iterator first, iterator last);
+
+        /// Заменяет содержимое вектора n копиями value
+        /// \param n Количество элементов
+        /// \param value Значение (может быть элементом самого вектора)
+        void assign(size_type n, const T &value);
+
+        /// Заменяет содержимое вектора элементами диапазона [first, last)
+        /// \param first Начало диапазона (не должен указывать в этот вектор)
+        /// \param last Конец диапазона
+        template <std::forward_iterator It>
+        requires std::constructible_from<T, std::iter_reference_t<It>>
+        void assign(It first, It last);
+
+        /// Вставляет копию value перед pos
+        /// \param pos Итератор, перед которым вставляется элемент
+        /// \param value Значение (может быть элементом самого вектора)
+        /// \return Итератор на вставленный элемент
+        iterator insert(iterator pos, const T &value){ return insert(pos, 1, value); }
+
+        /// Конструирует элемент перед pos
+        /// \tparam Args Типы аргументов конструктора
+        /// \param pos Итератор, перед которым вставляется элемент
+        /// \param args Аргументы конструктора
+        /// \return Итератор на вставленный элемент
+        template <typename ...Args>
+        requires std::constructible_from<T, Args...>
+        iterator emplace(iterator pos, Args &&... args){ return insert(pos, 1, T(std::forward<Args>(args)...)); }
+
+        /// Вставляет n копий value перед pos
+        /// \param pos Итератор, перед которым вставляются элементы
+        /// \param n Количество элементов
+        /// \param value Значение (может быть элементом самого вектора)
+        /// \return Итератор на первый вставленный элемент
+        iterator insert(iterator pos, size_type n, const T &value);
+
+        /// Вставляет элементы диапазона [first, last) перед pos
+        /// \param pos Итератор, перед которым вставляются элементы
+        /// \param first Начало диапазона (не должен указывать в этот вектор)
+        /// \param last Конец диапазона
+        /// \return Итератор на первый вставленный элемент
+        template <std::forward_iterator It>
+        requires std::constructible_from<T, std::iter_reference_t<It>>
+        iterator insert(iterator pos, It first, It last);
+
+        /// Сбрасывает изменённые страницы в файл (msync)
+        /// \param async true - MS_ASYNC, запись планируется без ожидания
+        void sync(bool async = false);
+
+        /// Передаёт ядру подсказку о порядке доступа (madvise). sequential, random и hugepage повторяются после роста отображения
+        /// \param hint Подсказка
+        /// \return true, если ядро приняло подсказку (hugepage для файлов поддерживается не всеми ядрами и ФС)
+        bool advise(mmap_advice hint) noexcept;
+
+        /// Возвращает итератор на начало вектора
+        /// \return Итератор на начало
+        iterator begin() noexcept{ return iterator(array); }
+
+        /// Возвращает итератор на конец вектора
+        /// \return Итератор на конец
+        iterator end() noexcept{ return iterator(array + _size); }
+
+        /// Возвращает константный итератор на начало вектора
+        /// \return Константный итератор на начало
+        const_iterator begin() const noexcept{ return const_iterator(array); }
+
+        /// Возвращает константный итератор на конец вектора
+        /// \return Константный итератор на конец
+        const_iterator end() const noexcept{ return const_iterator(array + _size); }
+
+        /// Возвращает константный итератор на начало вектора
+        /// \return Константный итератор на начало
+        const_iterator cbegin() const noexcept{ return const_iterator(array); }
+
+        /// Возвращает константный итератор на конец вектора
+        /// \return Константный итератор на конец
+        const_iterator cend() const noexcept{ return const_iterator(array + _size); }
+
+        /// Обменивает содержимое двух векторов
+        /// \param second Другой вектор
+        void swap(mmap_vector &second) noexcept;
+    };
+}
+
+namespace MyVec {
+    template <typename T, growth_policy GrowthPolicy>
+    mmap_vector<T, GrowthPolicy>::mmap_vector(const std::string &path, mmap_mode mode): mode{mode}{
+        fd = mode == mmap_mode::read_only ? ::open(path.c_str(), O_RDONLY | O_CLOEXEC)
+                                          : ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd < 0){
+            fail("mmap_vector: cannot open file");
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0){
+            int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "mmap_vector: cannot stat file");
+        }
+        size_type bytes = static_cast<size_type>(st.st_size);
+        if (bytes % sizeof(T) != 0){
+            ::close(fd);
+            throw std::invalid_argument("mmap_vector: file size is not a multiple of the element size");
+        }
+        _size = _capacity = bytes / sizeof(T);
+        if (bytes == 0){
+            return;
+        }
+        // Закрытое отображение файла только для чтения допускает запись: изменённые страницы копируются
+        int flags = mode == mmap_mode::read_only ? MAP_PRIVATE : MAP_SHARED;
+        void *p = ::mmap(nullptr, page_round(bytes), PROT_READ | PROT_WRITE, flags, fd, 0);
+        if (p == MAP_FAILED){
+            int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "mmap_vector: mmap failed");
+        }
+        array = static_cast<T *>(p);
+        mapped = page_round(bytes);
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    std::size_t mmap_vector<T, GrowthPolicy>::page_round(size_type bytes) noexcept{
+        static const size_type page = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+        return (bytes + page - 1) / page * page;
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::fail(const char *what){
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::require_writable() const{
+        if (mode == mmap_mode::read_only){
+            throw std::logic_error("mmap_vector: file is opened read-only");
+        }
+        if (fd < 0){
+            throw std::logic_error("mmap_vector: no file is mapped");
+        }
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::remap(size_type newCap){
+        size_type newBytes = page_round(newCap * sizeof(T));
+        // Файл удлиняется до конца страницы, чтобы вся отображённая область была им покрыта
+        if (::ftruncate(fd, static_cast<off_t>(newBytes)) != 0){
+            fail("mmap_vector: ftruncate failed");
+        }
+        void *p = array ? ::mremap(array, mapped, newBytes, MREMAP_MAYMOVE)
+                        : ::mmap(nullptr, newBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED){
+            int error = errno;
+            (void) ::ftruncate(fd, static_cast<off_t>(_capacity * sizeof(T)));
+            throw std::system_error(error, std::generic_category(), "mmap_vector: mremap failed");
+        }
+        array = static_cast<T *>(p);
+        mapped = newBytes;
+        _capacity = newBytes / sizeof(T);
+        // Подсказки о порядке доступа относятся ко всему отображению, разовые willneed/dontneed не повторяются
+        if (advice == mmap_advice::sequential || advice == mmap_advice::random || advice == mmap_advice::hugepage){
+            advise(advice);
+        }
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::grow_to(size_type required){
+        if (required > _capacity){
+            remap(GrowthPolicy::next_capacity(_capacity, required, sizeof(T)));
+        }
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::close() noexcept{
+        if (array){
+            ::munmap(array, mapped);
+        }
+        if (fd >= 0){
+            if (mode == mmap_mode::read_write){
+                (void) ::ftruncate(fd, static_cast<off_t>(_size * sizeof(T)));
+            }
+            ::close(fd);
+        }
+        array = nullptr;
+        mapped = 0;
+        fd = -1;
+        _size = _capacity = 0;
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::reserve(size_type newCap){
+        require_writable();
+        if (newCap > _capacity){
+            remap(newCap);
+        }
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::resize(size_type newSize){
+        resize(newSize, T());
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::resize(size_type newSize, const T &value){
+        require_writable();
+        if (newSize > _size){
+            T copy = value;
+            grow_to(newSize);
+            std::uninitialized_fill(array + _size, array + newSize, copy);
+        }
+        _size = newSize;
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    const T &mmap_vector<T, GrowthPolicy>::at(size_type index) const{
+        if (index >= _size){
+            throw std::out_of_range("Index out of range");
+        }
+        return array[index];
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    T &mmap_vector<T, GrowthPolicy>::at(size_type index){
+        if (index >= _size){
+            throw std::out_of_range("Index out of range");
+        }
+        return array[index];
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::push_back(const T &element){
+        emplace_back(element);
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    template <typename ...Args>
+    void mmap_vector<T, GrowthPolicy>::emplace_back(Args &&... args) requires std::constructible_from<T, Args...>{
+        require_writable();
+        // Аргументы могут ссылаться на элементы вектора, а рост может перенести отображение
+        T element(std::forward<Args>(args)...);
+        grow_to(_size + 1);
+        std::memcpy(static_cast<void *>(array + _size), static_cast<const void *>(&element), sizeof(T));
+        _size++;
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::clear(){
+        require_writable();
+        _size = 0;
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    iterator<T> mmap_vector<T, GrowthPolicy>::erase(iterator it){
+        return it >= end() ? erase(end(), end()) : erase(it, it + 1);
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    iterator<T> mmap_vector<T, GrowthPolicy>::erase(iterator first, iterator last){
+        require_writable();
+        if (first >= last){
+            return first;
+        }
+        std::memmove(static_cast<void *>(&*first), static_cast<const void *>(&*last), (end() - last) * sizeof(T));
+        _size -= last - first;
+        return first;
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::assign(size_type n, const T &value){
+        require_writable();
+        T copy = value;
+        grow_to(n);
+        std::uninitialized_fill_n(array, n, copy);
+        _size = n;
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    template <std::forward_iterator It>
+    requires std::constructible_from<T, std::iter_reference_t<It>>
+    void mmap_vector<T, GrowthPolicy>::assign(It first, It last){
+        require_writable();
+        size_type n = std::distance(first, last);
+        grow_to(n);
+        std::uninitialized_copy(first, last, array);
+        _size = n;
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    iterator<T> mmap_vector<T, GrowthPolicy>::insert(iterator pos, size_type n, const T &value){
+        require_writable();
+        size_type index = pos - begin();
+        T copy = value;
+        grow_to(_size + n);
+        std::memmove(static_cast<void *>(array + index + n), static_cast<const void *>(array + index),
+                     (_size - index) * sizeof(T));
+        std::uninitialized_fill_n(array + index, n, copy);
+        _size += n;
+        return begin() + index;
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    template <std::forward_iterator It>
+    requires std::constructible_from<T, std::iter_reference_t<It>>
+    iterator<T> mmap_vector<T, GrowthPolicy>::insert(iterator pos, It first, It last){
+        require_writable();
+        size_type index = pos - begin();
+        size_type n = std::distance(first, last);
+        grow_to(_size + n);
+        std::memmove(static_cast<void *>(array + index + n), static_cast<const void *>(array + index),
+                     (_size - index) * sizeof(T));
+        std::uninitialized_copy(first, last, array + index);
+        _size += n;
+        return begin() + index;
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::sync(bool async){
+        if (array && mode == mmap_mode::read_write &&
+            ::msync(array, mapped, async ? MS_ASYNC : MS_SYNC) != 0){
+            fail("mmap_vector: msync failed");
+        }
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    bool mmap_vector<T, GrowthPolicy>::advise(mmap_advice hint) noexcept{
+        advice = hint;
+        if (!array){
+            return true;
+        }
+        int native = MADV_NORMAL;
+        switch (hint){
+            case mmap_advice::normal: native = MADV_NORMAL; break;
+            case mmap_advice::sequential: native = MADV_SEQUENTIAL; break;
+            case mmap_advice::random: native = MADV_RANDOM; break;
+            case mmap_advice::willneed: native = MADV_WILLNEED; break;
+            case mmap_advice::dontneed: native = MADV_DONTNEED; break;
+            case mmap_advice::hugepage: native = MADV_HUGEPAGE; break;
+        }
+        return ::madvise(array, mapped, native) == 0;
+    }
+
+    template <typename T, growth_policy GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::swap(mmap_vector &second) noexcept{
+        std::swap(_size, second._size);
+        std::swap(_capacity, second._capacity);
+        std::swap(array, second.array);
+        std::swap(mapped, second.mapped);
+        std::swap(fd, second.fd);
+        std::swap(mode, second.mode);
+        std::swap(advice, second.advice);
+    }
+}
+
+#endif
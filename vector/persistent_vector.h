@@ -0,0 +1,777 @@
+#ifndef MYVEC_PERSISTENT_VECTOR_H
+#define MYVEC_PERSISTENT_VECTOR_H
+
+#include <atomic>
+#include <utility>
+#include "vector.h"
+
+namespace MyVec {
+    template <typename T>
+    class persistent_vector;
+
+    template <typename T>
+    class transient_vector;
+
+    namespace detail {
+        /// Дерево RRB (relaxed radix balanced): узлы по 32 потомка или элемента, у каждого внутреннего узла
+        /// таблица накопленных размеров поддеревьев. Поиск потомка начинается с радиксной оценки index >> shift
+        /// и для сбалансированных узлов сразу попадает в цель. Узлы неизменяемы, пока на них больше одной ссылки:
+        /// версии разделяют всё, кроме пути к изменённому элементу
+        /// \tparam T Тип хранимых значений
+        template <typename T>
+        struct rrb_tree {
+            static constexpr unsigned bits = 5;
+            static constexpr std::size_t branching = std::size_t{1} << bits;
+
+            struct node {
+                std::atomic<std::uint32_t> refs{1};
+                std::uint32_t count = 0;
+            };
+
+            struct leaf_node : node {
+                alignas(T) std::byte storage[branching * sizeof(T)];
+
+                T *items() noexcept{ return std::launder(reinterpret_cast<T *>(storage)); }
+
+                ~leaf_node(){ std::destroy_n(items(), this->count); }
+            };
+
+            struct inner_node : node {
+                node *children[branching];
+                std::size_t sizes[branching];
+            };
+
+            node *root = nullptr;
+            unsigned shift = 0;
+            std::size_t size = 0;
+
+            static leaf_node *as_leaf(node *n) noexcept{ return static_cast<leaf_node *>(n); }
+            static inner_node *as_inner(node *n) noexcept{ return static_cast<inner_node *>(n); }
+
+            static node *retain(node *n) noexcept{
+                n->refs.fetch_add(1, std::memory_order_relaxed);
+                return n;
+            }
+
+            static void release(node *n, unsigned level) noexcept{
+                if (!n || n->refs.fetch_sub(1, std::memory_order_acq_rel) != 1){
+                    return;
+                }
+                if (level == 0){
+                    delete as_leaf(n);
+                    return;
+                }
+                inner_node *inner = as_inner(n);
+                for (std::uint32_t i = 0; i < inner->count; i++){
+                    release(inner->children[i], level - bits);
+                }
+                delete inner;
+            }
+
+            static std::size_t subtree_size(node *n, unsigned level) noexcept{
+                return level == 0 ? n->count : as_inner(n)->sizes[n->count - 1];
+            }
+
+            /// Новый лист с копиями элементов [first, last) листа source
+            static leaf_node *copy_leaf(leaf_node *source, std::uint32_t first, std::uint32_t last){
+                auto *leaf = new leaf_node;
+                try {
+                    std::uninitialized_copy(source->items() + first, source->items() + last, leaf->items());
+                } catch (...){
+                    delete leaf;
+                    throw;
+                }
+                leaf->count = last - first;
+                return leaf;
+            }
+
+            /// Копия внутреннего узла; потомки разделяются
+            static inner_node *copy_inner(inner_node *source){
+                auto *inner = new inner_node;
+                inner->count = source->count;
+                for (std::uint32_t i = 0; i < source->count; i++){
+                    inner->children[i] = retain(source->children[i]);
+                    inner->sizes[i] = source->sizes[i];
+                }
+                return inner;
+            }
+
+            /// Узел, который можно изменять: сам узел в переходном режиме при единственной ссылке, иначе копия
+            static leaf_node *editable(leaf_node *n, bool transient){
+                return transient && n->refs.load(std::memory_order_acquire) == 1 ? n : copy_leaf(n, 0, n->count);
+            }
+
+            static inner_node *editable(inner_node *n, bool transient){
+                return transient && n->refs.load(std::memory_order_acquire) == 1 ? n : copy_inner(n);
+            }
+
+            /// Заменяет потомка изменяемого узла, отпуская прежнего
+            static void replace_child(inner_node *n, std::uint32_t i, node *child, unsigned level) noexcept{
+                if (n->children[i] != child){
+                    release(n->children[i], level - bits);
+                    n->children[i] = child;
+                }
+            }
+
+            /// Номер потомка, содержащего index: радиксная оценка и досмотр таблицы размеров
+            static std::uint32_t child_index(inner_node *n, std::size_t index, unsigned level) noexcept{
+                auto i = static_cast<std::uint32_t>(std::min<std::size_t>(index >> level, n->count - 1));
+                while (n->sizes[i] <= index){
+                    i++;
+                }
+                return i;
+            }
+
+            /// Лист, содержащий элемент index, и индекс первого элемента этого листа
+            std::pair<leaf_node *, std::size_t> find_leaf(std::size_t index) const noexcept{
+                node *n = root;
+                std::size_t start = 0;
+                for (unsigned level = shift; level > 0; level -= bits){
+                    inner_node *inner = as_inner(n);
+                    std::uint32_t i = child_index(inner, index - start, level);
+                    if (i){
+                        start += inner->sizes[i - 1];
+                    }
+                    n = inner->children[i];
+                }
+                return {as_leaf(n), start};
+            }
+
+            const T &get(std::size_t index) const noexcept{
+                auto [leaf, start] = find_leaf(index);
+                return leaf->items()[index - start];
+            }
+
+            /// Путь из узлов с единственным потомком до нового листа со значением
+            template <typename U>
+            static node *new_path(unsigned level, U &&value){
+                auto *leaf = new leaf_node;
+                try {
+                    std::construct_at(leaf->items(), std::forward<U>(value));
+                } catch (...){
+                    delete leaf;
+                    throw;
+                }
+                leaf->count = 1;
+                node *n = leaf;
+                for (unsigned l = bits; l <= level; l += bits){
+                    auto *inner = new inner_node;
+                    inner->children[0] = n;
+                    inner->sizes[0] = 1;
+                    inner->count = 1;
+                    n = inner;
+                }
+                return n;
+            }
+
+            static bool full(node *n, unsigned level) noexcept{
+                if (n->count < branching){
+                    return false;
+                }
+                return level == 0 || full(as_inner(n)->children[branching - 1], level - bits);
+            }
+
+            template <typename U>
+            static node *push(node *n, unsigned level, U &&value, bool transient){
+                if (level == 0){
+                    leaf_node *leaf = editable(as_leaf(n), transient);
+                    try {
+                        std::construct_at(leaf->items() + leaf->count, std::forward<U>(value));
+                    } catch (...){
+                        if (leaf != n){
+                            delete leaf;
+                        }
+                        throw;
+                    }
+                    leaf->count++;
+                    return leaf;
+                }
+                inner_node *source = as_inner(n);
+                std::uint32_t last = source->count - 1;
+                bool append = full(source->children[last], level - bits);
+                node *child = append ? new_path(level - bits, std::forward<U>(value)) : nullptr;
+                inner_node *inner = editable(source, transient);
+                if (append){
+                    inner->children[inner->count] = child;
+                    inner->sizes[inner->count] = inner->sizes[last] + 1;
+                    inner->count++;
+                    return inner;
+                }
+                try {
+                    child = push(inner->children[last], level - bits, std::forward<U>(value), transient);
+                } catch (...){
+                    if (inner != n){
+                        release(inner, level);
+                    }
+                    throw;
+                }
+                replace_child(inner, last, child, level);
+                inner->sizes[last]++;
+                return inner;
+            }
+
+            /// Добавляет элемент; в переходном режиме дерево изменяется на месте, иначе возвращается новое
+            template <typename U>
+            rrb_tree push_back(U &&value, bool transient) const{
+                rrb_tree result{nullptr, shift, size + 1};
+                if (!root){
+                    result.root = new_path(0, std::forward<U>(value));
+                } else if (full(root, shift)){
+                    node *path = new_path(shift, std::forward<U>(value));
+                    auto *inner = new inner_node;
+                    inner->children[0] = transient ? root : retain(root);
+                    inner->children[1] = path;
+                    inner->sizes[0] = size;
+                    inner->sizes[1] = size + 1;
+                    inner->count = 2;
+                    result.root = inner;
+                    result.shift = shift + bits;
+                } else {
+                    result.root = push(root, shift, std::forward<U>(value), transient);
+                    if (transient && result.root != root){
+                        release(root, shift);
+                    }
+                }
+                return result;
+            }
+
+            template <typename U>
+            static node *assign(node *n, unsigned level, std::size_t index, U &&value, bool transient){
+                if (level == 0){
+                    leaf_node *leaf = editable(as_leaf(n), transient);
+                    try {
+                        leaf->items()[index] = std::forward<U>(value);
+                    } catch (...){
+                        if (leaf != n){
+                            delete leaf;
+                        }
+                        throw;
+                    }
+                    return leaf;
+                }
+                inner_node *inner = editable(as_inner(n), transient);
+                std::uint32_t i = child_index(inner, index, level);
+                node *child;
+                try {
+                    child = assign(inner->children[i], level - bits, i ? index - inner->sizes[i - 1] : index,
+                                   std::forward<U>(value), transient);
+                } catch (...){
+                    if (inner != n){
+                        release(inner, level);
+                    }
+                    throw;
+                }
+                replace_child(inner, i, child, level);
+                return inner;
+            }
+
+            template <typename U>
+            rrb_tree set(std::size_t index, U &&value, bool transient) const{
+                rrb_tree result{assign(root, shift, index, std::forward<U>(value), transient), shift, size};
+                if (transient && result.root != root){
+                    release(root, shift);
+                }
+                return result;
+            }
+
+            /// Первые n элементов поддерева (0 < n <= размер поддерева)
+            static node *take(node *n, unsigned level, std::size_t count){
+                if (count == subtree_size(n, level)){
+                    return retain(n);
+                }
+                if (level == 0){
+                    return copy_leaf(as_leaf(n), 0, static_cast<std::uint32_t>(count));
+                }
+                inner_node *source = as_inner(n);
+                std::uint32_t i = child_index(source, count - 1, level);
+                std::size_t before = i ? source->sizes[i - 1] : 0;
+                node *child = take(source->children[i], level - bits, count - before);
+                auto *inner = new inner_node;
+                for (std::uint32_t j = 0; j < i; j++){
+                    inner->children[j] = retain(source->children[j]);
+                    inner->sizes[j] = source->sizes[j];
+                }
+                inner->children[i] = child;
+                inner->sizes[i] = count;
+                inner->count = i + 1;
+                return inner;
+            }
+
+            /// Поддерево без первых count элементов (count < размера поддерева)
+            static node *drop(node *n, unsigned level, std::size_t count){
+                if (count == 0){
+                    return retain(n);
+                }
+                if (level == 0){
+                    return copy_leaf(as_leaf(n), static_cast<std::uint32_t>(count), n->count);
+                }
+                inner_node *source = as_inner(n);
+                std::uint32_t i = child_index(source, count, level);
+                std::size_t before = i ? source->sizes[i - 1] : 0;
+                node *child = drop(source->children[i], level - bits, count - before);
+                auto *inner = new inner_node;
+                inner->children[0] = child;
+                for (std::uint32_t j = i + 1; j < source->count; j++){
+                    inner->children[j - i] = retain(source->children[j]);
+                }
+                for (std::uint32_t j = i; j < source->count; j++){
+                    inner->sizes[j - i] = source->sizes[j] - count;
+                }
+                inner->count = source->count - i;
+                return inner;
+            }
+
+            /// Убирает корни с единственным потомком
+            void collapse() noexcept{
+                while (shift > 0 && root->count == 1){
+                    node *child = retain(as_inner(root)->children[0]);
+                    release(root, shift);
+                    root = child;
+                    shift -= bits;
+                }
+            }
+
+            rrb_tree slice(std::size_t first, std::size_t last) const{
+                if (first == last){
+                    return {};
+                }
+                node *taken = take(root, shift, last);
+                rrb_tree result;
+                try {
+                    result = {drop(taken, shift, first), shift, last - first};
+                } catch (...){
+                    release(taken, shift);
+                    throw;
+                }
+                release(taken, shift);
+                result.collapse();
+                return result;
+            }
+
+            /// Внутренний узел из потомков уровня level - bits с пересчётом таблицы размеров
+            static inner_node *make_inner(node *const *children, std::uint32_t count, unsigned level){
+                auto *inner = new inner_node;
+                std::size_t total = 0;
+                for (std::uint32_t i = 0; i < count; i++){
+                    inner->children[i] = children[i];
+                    total += subtree_size(children[i], level - bits);
+                    inner->sizes[i] = total;
+                }
+                inner->count = count;
+                return inner;
+            }
+
+            /// Сливает поддеревья одной высоты по шву; результат - один или два узла этой высоты
+            static std::pair<node *, node *> merge(node *left, node *right, unsigned level){
+                if (level == 0){
+                    leaf_node *l = as_leaf(left), *r = as_leaf(right);
+                    if (l->count == branching){
+                        return {retain(l), retain(r)};
+                    }
+                    // Левый лист заполняется до конца, чтобы конкатенации не оставляли редких листов
+                    std::uint32_t moved = std::min<std::uint32_t>(r->count, branching - l->count);
+                    leaf_node *leaf = copy_leaf(l, 0, l->count);
+                    try {
+                        std::uninitialized_copy(r->items(), r->items() + moved, leaf->items() + leaf->count);
+                        leaf->count += moved;
+                        return {leaf, moved == r->count ? nullptr : copy_leaf(r, moved, r->count)};
+                    } catch (...){
+                        delete leaf;
+                        throw;
+                    }
+                }
+                inner_node *l = as_inner(left), *r = as_inner(right);
+                auto [first, second] = merge(l->children[l->count - 1], r->children[0], level - bits);
+                node *children[2 * branching];
+                std::uint32_t count = 0;
+                for (std::uint32_t i = 0; i + 1 < l->count; i++){
+                    children[count++] = retain(l->children[i]);
+                }
+                children[count++] = first;
+                if (second){
+                    children[count++] = second;
+                }
+                for (std::uint32_t i = 1; i < r->count; i++){
+                    children[count++] = retain(r->children[i]);
+                }
+                if (count <= branching){
+                    return {make_inner(children, count, level), nullptr};
+                }
+                return {make_inner(children, branching, level), make_inner(children + branching, count - branching, level)};
+            }
+
+            /// Цепочка узлов с единственным потомком, поднимающая поддерево с уровня from до уровня to
+            static node *lift(node *n, unsigned from, unsigned to){
+                node *result = retain(n);
+                for (unsigned level = from + bits; level <= to; level += bits){
+                    result = make_inner(&result, 1, level);
+                }
+                return result;
+            }
+
+            rrb_tree concat(const rrb_tree &second) const{
+                if (!second.root){
+                    return {root ? retain(root) : nullptr, shift, size};
+                }
+                if (!root){
+                    return {retain(second.root), second.shift, second.size};
+                }
+                unsigned level = std::max(shift, second.shift);
+                node *left = lift(root, shift, level), *right = lift(second.root, second.shift, level);
+                auto [first, rest] = merge(left, right, level);
+                release(left, level);
+                release(right, level);
+                rrb_tree result{first, level, size + second.size};
+                if (rest){
+                    node *pair[2] = {first, rest};
+                    result.root = make_inner(pair, 2, level + bits);
+                    result.shift = level + bits;
+                }
+                result.collapse();
+                return result;
+            }
+        };
+    }
+
+    /// Итератор persistent_vector: помнит текущий лист, поэтому спуск по дереву выполняется раз в 32 элемента
+    /// \tparam T адресуемый итератором тип
+    template <typename T>
+    class PersistentIterator {
+    private:
+        using tree = detail::rrb_tree<T>;
+
+        const tree *owner = nullptr;
+        std::size_t index = 0;
+        const T *items = nullptr;
+        std::size_t leafStart = 0;
+        std::size_t leafEnd = 0;
+
+        void locate() noexcept{
+            if (index >= leafStart && index < leafEnd){
+                return;
+            }
+            if (index >= owner->size){
+                return;
+            }
+            auto [leaf, start] = owner->find_leaf(index);
+            items = leaf->items();
+            leafStart = start;
+            leafEnd = start + leaf->count;
+        }
+    public:
+        /// Категория итератора
+        using iterator_category = std::random_access_iterator_tag;
+
+        /// Адресуемый итератором тип
+        using value_type = T;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Тип указателя на хранимое значение
+        using pointer = const T *;
+
+        /// Тип ссылки на хранимое значение
+        using reference = const T &;
+
+        /// Пустой конструктор
+        PersistentIterator() noexcept = default;
+
+        /// Конструктор по дереву и индексу
+        /// \param owner Дерево вектора
+        /// \param index Индекс элемента
+        PersistentIterator(const tree *owner, std::size_t index) noexcept: owner{owner}, index{index}{ locate(); }
+
+        reference operator*() const noexcept{ return items[index - leafStart]; }
+
+        pointer operator->() const noexcept{ return &**this; }
+
+        reference operator[](difference_type n) const noexcept{ return *(*this + n); }
+
+        PersistentIterator &operator++() noexcept{
+            ++index;
+            locate();
+            return *this;
+        }
+
+        PersistentIterator operator++(int) noexcept{
+            PersistentIterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        PersistentIterator &operator--() noexcept{
+            --index;
+            locate();
+            return *this;
+        }
+
+        PersistentIterator operator--(int) noexcept{
+            PersistentIterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        PersistentIterator &operator+=(difference_type n) noexcept{
+            index += n;
+            locate();
+            return *this;
+        }
+
+        PersistentIterator &operator-=(difference_type n) noexcept{ return *this += -n; }
+
+        friend PersistentIterator operator+(PersistentIterator it, difference_type n) noexcept{ return it += n; }
+
+        friend PersistentIterator operator+(difference_type n, PersistentIterator it) noexcept{ return it += n; }
+
+        friend PersistentIterator operator-(PersistentIterator it, difference_type n) noexcept{ return it -= n; }
+
+        friend difference_type operator-(const PersistentIterator &a, const PersistentIterator &b) noexcept{
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+
+        bool operator==(const PersistentIterator &other) const noexcept{ return index == other.index; }
+
+        auto operator<=>(const PersistentIterator &other) const noexcept{ return index <=> other.index; }
+    };
+
+    /// Неизменяемый вектор со структурным разделением на основе RRB-дерева. push_back, set, concat и slice
+    /// выполняются за O(log32 n) и возвращают новую версию, разделяющую с исходной все узлы, кроме изменённого
+    /// пути. Версии можно читать из разных потоков. Для серии изменений используется transient()
+    /// \tparam T Тип хранимых значений
+    template <typename T>
+    class persistent_vector {
+        static_assert(std::copy_constructible<T>, "persistent_vector copies elements on path copying");
+    private:
+        using tree = detail::rrb_tree<T>;
+
+        tree data;
+
+        explicit persistent_vector(tree data) noexcept: data{data}{}
+
+        friend class transient_vector<T>;
+    public:
+        /// Тип итератора
+        using iterator = PersistentIterator<T>;
+
+        /// Тип константного итератора
+        using const_iterator = PersistentIterator<T>;
+
+        /// Тип хранимых значений
+        using value_type = T;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Константная ссылка на тип хранимых значений
+        using const_reference = const T &;
+
+        /// Пустой конструктор
+        persistent_vector() noexcept = default;
+
+        /// Конструктор по списку инициализации
+        /// \param list Список инициализации
+        persistent_vector(std::initializer_list<T> list);
+
+        /// Конструктор копирования: версии разделяют дерево
+        /// \param second Копируемый вектор
+        persistent_vector(const persistent_vector &second) noexcept: data{second.data}{
+            if (data.root){
+                tree::retain(data.root);
+            }
+        }
+
+        /// Конструктор перемещения
+        /// \param second Перемещаемый вектор
+        persistent_vector(persistent_vector &&second) noexcept: data{std::exchange(second.data, tree{})}{}
+
+        /// Оператор присваивания
+        /// \param second Копируемый или перемещаемый вектор
+        /// \return Ссылка на текущий вектор
+        persistent_vector &operator=(persistent_vector second) noexcept{
+            std::swap(data, second.data);
+            return *this;
+        }
+
+        /// Деструктор
+        ~persistent_vector(){ tree::release(data.root, data.shift); }
+
+        /// Возвращает версию с добавленным в конец элементом
+        /// \param value Значение элемента
+        /// \return Новая версия
+        [[nodiscard]] persistent_vector push_back(T value) const{
+            return persistent_vector(data.push_back(std::move(value), false));
+        }
+
+        /// Возвращает версию с заменённым элементом
+        /// \param index Индекс элемента
+        /// \param value Новое значение
+        /// \return Новая версия
+        [[nodiscard]] persistent_vector set(size_type index, T value) const;
+
+        /// Возвращает конкатенацию с другим вектором
+        /// \param second Второй вектор
+        /// \return Новая версия
+        [[nodiscard]] persistent_vector concat(const persistent_vector &second) const{
+            return persistent_vector(data.concat(second.data));
+        }
+
+        /// Возвращает элементы [first, last)
+        /// \param first Индекс первого элемента
+        /// \param last Индекс за последним элементом
+        /// \return Новая версия
+        [[nodiscard]] persistent_vector slice(size_type first, size_type last) const;
+
+        /// Возвращает версию без последнего элемента
+        /// \return Новая версия
+        [[nodiscard]] persistent_vector pop_back() const{ return slice(0, size() - 1); }
+
+        /// Создаёт изменяемую копию для серии изменений; исходная версия не меняется
+        /// \return Переходный вектор
+        [[nodiscard]] transient_vector<T> transient() const &{ return transient_vector<T>(*this); }
+
+        /// Оператор доступа к элементу по индексу
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент
+        [[nodiscard]] const T &operator[](size_type index) const noexcept{ return data.get(index); }
+
+        /// Возвращает ссылку на элемент с проверкой индекса
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент
+        [[nodiscard]] const T &at(size_type index) const;
+
+        /// Возвращает ссылку на первый элемент
+        /// \return Константная ссылка на первый элемент
+        [[nodiscard]] const T &front() const noexcept{ return (*this)[0]; }
+
+        /// Возвращает ссылку на последний элемент
+        /// \return Константная ссылка на последний элемент
+        [[nodiscard]] const T &back() const noexcept{ return (*this)[size() - 1]; }
+
+        /// Возвращает размер вектора
+        /// \return Размер вектора
+        [[nodiscard]] size_type size() const noexcept{ return data.size; }
+
+        /// Проверяет, является ли вектор пустым
+        /// \return true, если размер вектора равен нулю
+        [[nodiscard]] bool empty() const noexcept{ return data.size == 0; }
+
+        /// Возвращает итератор на начало вектора
+        /// \return Итератор на начало
+        const_iterator begin() const noexcept{ return const_iterator(&data, 0); }
+
+        /// Возвращает итератор на конец вектора
+        /// \return Итератор на конец
+        const_iterator end() const noexcept{ return const_iterator(&data, data.size); }
+    };
+
+    /// Переходный (изменяемый) вектор для серии изменений persistent_vector. Узлы, принадлежащие только ему,
+    /// меняются на месте, разделяемые с версиями - копируются один раз. Не потокобезопасен
+    /// \tparam T Тип хранимых значений
+    template <typename T>
+    class transient_vector {
+    private:
+        using tree = detail::rrb_tree<T>;
+
+        tree data;
+    public:
+        /// Тип хранимых значений
+        using value_type = T;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+
+        /// Пустой конструктор
+        transient_vector() noexcept = default;
+
+        /// Конструктор по версии: дерево разделяется до первого изменения
+        /// \param source Версия
+        explicit transient_vector(const persistent_vector<T> &source) noexcept: data{source.data}{
+            if (data.root){
+                tree::retain(data.root);
+            }
+        }
+
+        transient_vector(const transient_vector &) = delete;
+        transient_vector &operator=(const transient_vector &) = delete;
+
+        /// Конструктор перемещения
+        /// \param second Перемещаемый вектор
+        transient_vector(transient_vector &&second) noexcept: data{std::exchange(second.data, tree{})}{}
+
+        /// Деструктор
+        ~transient_vector(){ tree::release(data.root, data.shift); }
+
+        /// Добавляет элемент в конец
+        /// \param value Значение элемента
+        void push_back(T value){ data = data.push_back(std::move(value), true); }
+
+        /// Заменяет элемент
+        /// \param index Индекс элемента
+        /// \param value Новое значение
+        void set(size_type index, T value);
+
+        /// Оператор доступа к элементу по индексу
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент
+        [[nodiscard]] const T &operator[](size_type index) const noexcept{ return data.get(index); }
+
+        /// Возвращает размер вектора
+        /// \return Размер вектора
+        [[nodiscard]] size_type size() const noexcept{ return data.size; }
+
+        /// Завершает серию изменений; переходный вектор становится пустым
+        /// \return Неизменяемая версия
+        [[nodiscard]] persistent_vector<T> persistent() &&noexcept{
+            return persistent_vector<T>(std::exchange(data, tree{}));
+        }
+    };
+}
+
+namespace MyVec {
+    template <typename T>
+    persistent_vector<T>::persistent_vector(std::initializer_list<T> list){
+        transient_vector<T> builder;
+        for (const T &element: list){
+            builder.push_back(element);
+        }
+        *this = std::move(builder).persistent();
+    }
+
+    template <typename T>
+    persistent_vector<T> persistent_vector<T>::set(size_type index, T value) const{
+        if (index >= size()){
+            throw std::out_of_range("Index out of range");
+        }
+        return persistent_vector(data.set(index, std::move(value), false));
+    }
+
+    template <typename T>
+    persistent_vector<T> persistent_vector<T>::slice(size_type first, size_type last) const{
+        if (first > last || last > size()){
+            throw std::out_of_range("Slice is out of range");
+        }
+        return persistent_vector(data.slice(first, last));
+    }
+
+    template <typename T>
+    const T &persistent_vector<T>::at(size_type index) const{
+        if (index >= size()){
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    template <typename T>
+    void transient_vector<T>::set(size_type index, T value){
+        if (index >= size()){
+            throw std::out_of_range("Index out of range");
+        }
+        data = data.set(index, std::move(value), true);
+    }
+}
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef MYVEC_REALLOC_ALLOCATOR_H
+#define MYVEC_REALLOC_ALLOCATOR_H
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <malloc.h>
+#include <new>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "vector.h"
+
+namespace MyVec {
+    /// Аллокатор, умеющий расширять блок на месте.
+    /// Блоки меньше mmap_threshold байт выделяются через malloc и растут через realloc,
+    /// большие блоки - анонимные отображения, растущие через mremap(MREMAP_MAYMOVE) без копирования данных.
+    /// vector использует reallocate() только для тривиально перемещаемых типов
+    /// \tparam T Тип хранимых значений
+    template <typename T>
+    class realloc_allocator {
+    public:
+        /// Тип хранимых значений
+        using value_type = T;
+
+        /// Размер блока в байтах, начиная с которого память берётся через mmap
+        static constexpr std::size_t mmap_threshold = std::size_t{4} << 20;
+
+        realloc_allocator() noexcept = default;
+
+        /// Конструктор из аллокатора другого типа (для rebind)
+        template <typename U>
+        realloc_allocator(const realloc_allocator<U> &) noexcept{}
+
+        /// Выделяет память под n элементов
+        /// \param n Количество элементов
+        /// \return Указатель на выделенную память
+        [[nodiscard]] T *allocate(std::size_t n);
+
+        /// Выделяет память не меньше чем под n элементов и сообщает фактическую ёмкость блока:
+        /// запас малых блоков определяется через malloc_usable_size, большие блоки округляются до страниц
+        /// \param n Количество элементов
+        /// \return Указатель на память и ёмкость блока в элементах
+        [[nodiscard]] allocation_result<T *> allocate_at_least(std::size_t n){
+            T *p = allocate(n);
+            return {p, usable(p, n)};
+        }
+
+        /// Освобождает память, выделенную allocate() или reallocate()
+        /// \param p Указатель на память
+        /// \param n Количество элементов, под которое выделялась память
+        void deallocate(T *p, std::size_t n) noexcept;
+
+        /// Изменяет размер блока, по возможности на месте. Содержимое переносится побайтово
+        /// \param p Указатель на текущий блок
+        /// \param oldN Текущая ёмкость блока в элементах
+        /// \param newN Новая ёмкость блока в элементах
+        /// \return Указатель на блок нового размера
+        [[nodiscard]] T *reallocate(T *p, std::size_t oldN, std::size_t newN);
+
+        /// Изменяет размер блока, как reallocate(), и сообщает фактическую ёмкость нового блока
+        /// \param p Указатель на текущий блок
+        /// \param oldN Текущая ёмкость блока в элементах
+        /// \param newN Требуемая ёмкость блока в элементах
+        /// \return Указатель на блок и его ёмкость в элементах
+        [[nodiscard]] allocation_result<T *> reallocate_at_least(T *p, std::size_t oldN, std::size_t newN){
+            T *np = reallocate(p, oldN, newN);
+            return {np, usable(np, newN)};
+        }
+
+        template <typename U>
+        bool operator==(const realloc_allocator<U> &) const noexcept{ return true; }
+    private:
+        static std::size_t page_round(std::size_t bytes) noexcept;
+        static bool is_mapped(std::size_t bytes) noexcept{ return bytes >= mmap_threshold; }
+        static std::size_t usable(T *p, std::size_t n) noexcept;
+    };
+}
+
+namespace MyVec {
+    template <typename T>
+    std::size_t realloc_allocator<T>::page_round(std::size_t bytes) noexcept{
+        static const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return (bytes + page - 1) / page * page;
+    }
+
+    template <typename T>
+    std::size_t realloc_allocator<T>::usable(T *p, std::size_t n) noexcept{
+        std::size_t bytes = n * sizeof(T);
+        if (is_mapped(bytes)){
+            return page_round(bytes) / sizeof(T);
+        }
+        // Ёмкость не должна переходить порог mmap: deallocate() выбирает способ освобождения по ней
+        bytes = std::min(::malloc_usable_size(p), mmap_threshold - 1);
+        return std::max(bytes / sizeof(T), n);
+    }
+
+    template <typename T>
+    T *realloc_allocator<T>::allocate(std::size_t n){
+        std::size_t bytes = n * sizeof(T);
+        if (n > std::size_t(-1) / sizeof(T)){
+            throw std::bad_array_new_length();
+        }
+        void *p;
+        if (is_mapped(bytes)){
+            p = ::mmap(nullptr, page_round(bytes), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED){
+                throw std::bad_alloc();
+            }
+        } else {
+            static_assert(alignof(T) <= alignof(std::max_align_t), "realloc_allocator does not support over-aligned types");
+            p = std::malloc(bytes);
+            if (!p){
+                throw std::bad_alloc();
+            }
+        }
+        return static_cast<T *>(p);
+    }
+
+    template <typename T>
+    void realloc_allocator<T>::deallocate(T *p, std::size_t n) noexcept{
+        std::size_t bytes = n * sizeof(T);
+        if (is_mapped(bytes)){
+            ::munmap(p, page_round(bytes));
+        } else {
+            std::free(p);
+        }
+    }
+
+    template <typename T>
+    T *realloc_allocator<T>::reallocate(T *p, std::size_t oldN, std::size_t newN){
+        std::size_t oldBytes = oldN * sizeof(T);
+        std::size_t newBytes = newN * sizeof(T);
+        if (newN > std::size_t(-1) / sizeof(T)){
+            throw std::bad_array_new_length();
+        }
+        if (is_mapped(oldBytes) && is_mapped(newBytes)){
+            void *np = ::mremap(p, page_round(oldBytes), page_round(newBytes), MREMAP_MAYMOVE);
+            if (np == MAP_FAILED){
+                throw std::bad_alloc();
+            }
+            return static_cast<T *>(np);
+        }
+        if (!is_mapped(oldBytes) && !is_mapped(newBytes)){
+            void *np = std::realloc(static_cast<void *>(p), newBytes);
+            if (!np){
+                throw std::bad_alloc();
+            }
+            return static_cast<T *>(np);
+        }
+        // Переход между malloc и mmap: новый блок и одно побайтовое копирование
+        T *np = allocate(newN);
+        std::memcpy(static_cast<void *>(np), static_cast<const void *>(p), std::min(oldBytes, newBytes));
+        deallocate(p, oldN);
+        return np;
+    }
+}
+
+#endif
@@ -0,0 +1,466 @@
+#ifndef MYVEC_SIMD_H
+#define MYVEC_SIMD_H
+
+#include <cstdint>
+#include <utility>
+#include "vector.h"
+
+namespace MyVec::simd {
+    /// Типы, для которых есть векторные реализации алгоритмов
+    template <typename T>
+    concept arithmetic = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+    /// Тип результата sum/dot: 64-битное целое для целых типов, сам тип для чисел с плавающей точкой
+    template <arithmetic T>
+    using sum_type = std::conditional_t<std::is_floating_point_v<T>, T,
+            std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+
+    /// Набор инструкций, используемый алгоритмами
+    enum class isa {
+        scalar, sse2, avx2, avx512
+    };
+
+    /// Определяет лучший доступный набор инструкций через CPUID (один раз за время работы программы)
+    /// \return Набор инструкций
+    isa current_isa() noexcept;
+
+    /// Ищет первый элемент, равный value
+    /// \return Итератор на найденный элемент или end()
+    template <arithmetic T, typename A, typename G, typename Tl>
+    VectorIterator<T, true> find(const vector<T, A, G, Tl> &v, std::type_identity_t<T> value) noexcept;
+
+    /// Ищет первый элемент, равный value
+    /// \return Итератор на найденный элемент или end()
+    template <arithmetic T, typename A, typename G, typename Tl>
+    VectorIterator<T, false> find(vector<T, A, G, Tl> &v, std::type_identity_t<T> value) noexcept;
+
+    /// Считает элементы, равные value
+    /// \return Количество элементов
+    template <arithmetic T, typename A, typename G, typename Tl>
+    std::size_t count(const vector<T, A, G, Tl> &v, std::type_identity_t<T> value) noexcept;
+
+    /// Проверяет, есть ли в векторе элемент, равный value
+    /// \return true, если элемент найден
+    template <arithmetic T, typename A, typename G, typename Tl>
+    bool contains(const vector<T, A, G, Tl> &v, std::type_identity_t<T> value) noexcept;
+
+    /// Минимальный элемент. Для векторов с NaN результат не определён
+    /// \return Значение минимального элемента
+    /// \throw std::out_of_range если вектор пуст
+    template <arithmetic T, typename A, typename G, typename Tl>
+    T min(const vector<T, A, G, Tl> &v);
+
+    /// Максимальный элемент. Для векторов с NaN результат не определён
+    /// \return Значение максимального элемента
+    /// \throw std::out_of_range если вектор пуст
+    template <arithmetic T, typename A, typename G, typename Tl>
+    T max(const vector<T, A, G, Tl> &v);
+
+    /// Минимальный и максимальный элементы за один проход
+    /// \return Пара {минимум, максимум}
+    /// \throw std::out_of_range если вектор пуст
+    template <arithmetic T, typename A, typename G, typename Tl>
+    std::pair<T, T> minmax(const vector<T, A, G, Tl> &v);
+
+    /// Сумма элементов. Порядок сложения отличается от последовательного, поэтому для чисел
+    /// с плавающей точкой результат может отличаться от std::accumulate в пределах погрешности
+    /// \return Сумма
+    template <arithmetic T, typename A, typename G, typename Tl>
+    sum_type<T> sum(const vector<T, A, G, Tl> &v) noexcept;
+
+    /// Скалярное произведение
+    /// \return Сумма попарных произведений
+    /// \throw std::invalid_argument если размеры векторов различаются
+    template <arithmetic T, typename A1, typename G1, typename Tl1, typename A2, typename G2, typename Tl2>
+    sum_type<T> dot(const vector<T, A1, G1, Tl1> &a, const vector<T, A2, G2, Tl2> &b);
+
+    /// Первая позиция, в которой векторы различаются (сравнивается общая часть)
+    /// \return Пара итераторов на различающиеся элементы
+    template <arithmetic T, typename A1, typename G1, typename Tl1, typename A2, typename G2, typename Tl2>
+    std::pair<VectorIterator<T, true>, VectorIterator<T, true>>
+    mismatch(const vector<T, A1, G1, Tl1> &a, const vector<T, A2, G2, Tl2> &b) noexcept;
+
+    /// Поэлементное равенство векторов
+    /// \return true, если размеры и все элементы совпадают
+    template <arithmetic T, typename A1, typename G1, typename Tl1, typename A2, typename G2, typename Tl2>
+    bool equal(const vector<T, A1, G1, Tl1> &a, const vector<T, A2, G2, Tl2> &b) noexcept;
+}
+
+namespace MyVec::simd::detail {
+    /// Векторный тип GCC из W байт элементов T (псевдоним шаблона не переносит атрибут vector_size)
+    template <typename T, std::size_t W>
+    struct vector_type {
+        typedef T type __attribute__((vector_size(W)));
+    };
+
+    /// Реализации алгоритмов на векторных типах GCC шириной W байт. Функции встраиваются в обёртки
+    /// с атрибутом target, поэтому один и тот же код собирается под SSE2, AVX2 и AVX-512
+    template <std::size_t W>
+    struct kernels {
+        template <typename T>
+        using vec = typename vector_type<T, W>::type;
+
+        template <typename T>
+        static constexpr std::size_t lanes = W / sizeof(T);
+
+        // Векторы не передаются по значению: это меняет ABI вне функций с атрибутом target
+        template <typename T>
+        [[gnu::always_inline]] static inline const vec<T> &load(const T *p, vec<T> &v) noexcept{
+            std::memcpy(&v, p, W);
+            return v;
+        }
+
+        template <typename M>
+        [[gnu::always_inline]] static inline bool any(const M &mask) noexcept{
+            std::uint64_t words[W / 8];
+            std::memcpy(words, &mask, W);
+            std::uint64_t acc = 0;
+            for (std::uint64_t word: words){
+                acc |= word;
+            }
+            return acc != 0;
+        }
+
+        template <typename T>
+        [[gnu::always_inline]] static inline std::size_t find(const T *p, std::size_t n, T value) noexcept{
+            constexpr std::size_t L = lanes<T>;
+            vec<T> needle = vec<T>{} + value, chunk;
+            std::size_t i = 0;
+            for (; i + L <= n; i += L){
+                if (any(load(p + i, chunk) == needle)){
+                    break;
+                }
+            }
+            for (; i < n; i++){
+                if (p[i] == value){
+                    return i;
+                }
+            }
+            return n;
+        }
+
+        template <typename T>
+        [[gnu::always_inline]] static inline std::size_t count(const T *p, std::size_t n, T value) noexcept{
+            constexpr std::size_t L = lanes<T>;
+            // Счётчики в полосах имеют ширину T, поэтому сбрасываются не реже чем раз в 127 итераций
+            constexpr std::size_t block = 127;
+            using mask = decltype(vec<T>{} == vec<T>{});
+            vec<T> needle = vec<T>{} + value, chunk;
+            std::size_t total = 0;
+            std::size_t i = 0;
+            while (i + L <= n){
+                mask counters{};
+                for (std::size_t k = 0; k < block && i + L <= n; k++, i += L){
+                    counters -= load(p + i, chunk) == needle;
+                }
+                for (std::size_t j = 0; j < L; j++){
+                    total += static_cast<std::size_t>(counters[j]);
+                }
+            }
+            for (; i < n; i++){
+                total += p[i] == value;
+            }
+            return total;
+        }
+
+        template <typename T>
+        [[gnu::always_inline]] static inline std::pair<T, T> minmax(const T *p, std::size_t n) noexcept{
+            constexpr std::size_t L = lanes<T>;
+            T lo = p[0], hi = p[0];
+            std::size_t i = 0;
+            if (n >= L){
+                vec<T> vlo, vhi, chunk;
+                vhi = load(p, vlo);
+                for (i = L; i + L <= n; i += L){
+                    load(p + i, chunk);
+                    vlo = chunk < vlo ? chunk : vlo;
+                    vhi = chunk > vhi ? chunk : vhi;
+                }
+                for (std::size_t j = 0; j < L; j++){
+                    lo = vlo[j] < lo ? vlo[j] : lo;
+                    hi = vhi[j] > hi ? vhi[j] : hi;
+                }
+            }
+            for (; i < n; i++){
+                lo = p[i] < lo ? p[i] : lo;
+                hi = p[i] > hi ? p[i] : hi;
+            }
+            return {lo, hi};
+        }
+
+        template <typename T>
+        [[gnu::always_inline]] static inline sum_type<T> sum(const T *p, std::size_t n) noexcept{
+            using S = sum_type<T>;
+            constexpr std::size_t L = lanes<T>;
+            using wide = typename vector_type<S, L * sizeof(S)>::type;
+            wide acc{};
+            vec<T> chunk;
+            std::size_t i = 0;
+            for (; i + L <= n; i += L){
+                acc += __builtin_convertvector(load(p + i, chunk), wide);
+            }
+            S total{};
+            for (std::size_t j = 0; j < L; j++){
+                total += acc[j];
+            }
+            for (; i < n; i++){
+                total += static_cast<S>(p[i]);
+            }
+            return total;
+        }
+
+        template <typename T>
+        [[gnu::always_inline]] static inline sum_type<T> dot(const T *a, const T *b, std::size_t n) noexcept{
+            using S = sum_type<T>;
+            constexpr std::size_t L = lanes<T>;
+            using wide = typename vector_type<S, L * sizeof(S)>::type;
+            wide acc{};
+            vec<T> x, y;
+            std::size_t i = 0;
+            for (; i + L <= n; i += L){
+                acc += __builtin_convertvector(load(a + i, x), wide) * __builtin_convertvector(load(b + i, y), wide);
+            }
+            S total{};
+            for (std::size_t j = 0; j < L; j++){
+                total += acc[j];
+            }
+            for (; i < n; i++){
+                total += static_cast<S>(a[i]) * static_cast<S>(b[i]);
+            }
+            return total;
+        }
+
+        template <typename T>
+        [[gnu::always_inline]] static inline std::size_t mismatch(const T *a, const T *b, std::size_t n) noexcept{
+            constexpr std::size_t L = lanes<T>;
+            vec<T> x, y;
+            std::size_t i = 0;
+            for (; i + L <= n; i += L){
+                if (any(load(a + i, x) != load(b + i, y))){
+                    break;
+                }
+            }
+            for (; i < n; i++){
+                if (a[i] != b[i]){
+                    return i;
+                }
+            }
+            return n;
+        }
+    };
+
+    /// Скалярные реализации, используемые без поддержки SIMD
+    struct scalar {
+        template <typename T>
+        static std::size_t find(const T *p, std::size_t n, T value) noexcept{
+            for (std::size_t i = 0; i < n; i++){
+                if (p[i] == value){
+                    return i;
+                }
+            }
+            return n;
+        }
+
+        template <typename T>
+        static std::size_t count(const T *p, std::size_t n, T value) noexcept{
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < n; i++){
+                total += p[i] == value;
+            }
+            return total;
+        }
+
+        template <typename T>
+        static std::pair<T, T> minmax(const T *p, std::size_t n) noexcept{
+            T lo = p[0], hi = p[0];
+            for (std::size_t i = 1; i < n; i++){
+                lo = p[i] < lo ? p[i] : lo;
+                hi = p[i] > hi ? p[i] : hi;
+            }
+            return {lo, hi};
+        }
+
+        template <typename T>
+        static sum_type<T> sum(const T *p, std::size_t n) noexcept{
+            sum_type<T> total{};
+            for (std::size_t i = 0; i < n; i++){
+                total += static_cast<sum_type<T>>(p[i]);
+            }
+            return total;
+        }
+
+        template <typename T>
+        static sum_type<T> dot(const T *a, const T *b, std::size_t n) noexcept{
+            sum_type<T> total{};
+            for (std::size_t i = 0; i < n; i++){
+                total += static_cast<sum_type<T>>(a[i]) * static_cast<sum_type<T>>(b[i]);
+            }
+            return total;
+        }
+
+        template <typename T>
+        static std::size_t mismatch(const T *a, const T *b, std::size_t n) noexcept{
+            for (std::size_t i = 0; i < n; i++){
+                if (a[i] != b[i]){
+                    return i;
+                }
+            }
+            return n;
+        }
+    };
+
+#if defined(__x86_64__) || defined(__i386__)
+#define MYVEC_SIMD_TARGET(NAME, TARGET, WIDTH)                                                           \
+    struct NAME {                                                                                        \
+        template <typename T>                                                                            \
+        [[gnu::target(TARGET)]] static std::size_t find(const T *p, std::size_t n, T value) noexcept{   \
+            return kernels<WIDTH>::find(p, n, value);                                                    \
+        }                                                                                                \
+        template <typename T>                                                                            \
+        [[gnu::target(TARGET)]] static std::size_t count(const T *p, std::size_t n, T value) noexcept{  \
+            return kernels<WIDTH>::count(p, n, value);                                                   \
+        }                                                                                                \
+        template <typename T>                                                                            \
+        [[gnu::target(TARGET)]] static std::pair<T, T> minmax(const T *p, std::size_t n) noexcept{      \
+            return kernels<WIDTH>::minmax(p, n);                                                         \
+        }                                                                                                \
+        template <typename T>                                                                            \
+        [[gnu::target(TARGET)]] static sum_type<T> sum(const T *p, std::size_t n) noexcept{             \
+            return kernels<WIDTH>::sum(p, n);                                                            \
+        }                                                                                                \
+        template <typename T>                                                                            \
+        [[gnu::target(TARGET)]] static sum_type<T> dot(const T *a, const T *b, std::size_t n) noexcept{ \
+            return kernels<WIDTH>::dot(a, b, n);                                                         \
+        }                                                                                                \
+        template <typename T>                                                                            \
+        [[gnu::target(TARGET)]] static std::size_t mismatch(const T *a, const T *b, std::size_t n) noexcept{ \
+            return kernels<WIDTH>::mismatch(a, b, n);                                                    \
+        }                                                                                                \
+    };
+
+    MYVEC_SIMD_TARGET(sse2, "sse2", 16)
+    MYVEC_SIMD_TARGET(avx2, "avx2", 32)
+    MYVEC_SIMD_TARGET(avx512, "avx512f,avx512bw", 64)
+#undef MYVEC_SIMD_TARGET
+#endif
+
+    /// Вызывает f с набором реализаций для текущего процессора
+    template <typename F>
+    decltype(auto) dispatch(F &&f){
+#if defined(__x86_64__) || defined(__i386__)
+        switch (current_isa()){
+            case isa::avx512:
+                return f(avx512{});
+            case isa::avx2:
+                return f(avx2{});
+            case isa::sse2:
+                return f(sse2{});
+            default:
+                break;
+        }
+#endif
+        return f(scalar{});
+    }
+}
+
+namespace MyVec::simd {
+    inline isa current_isa() noexcept{
+        static const isa level = []{
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")){
+                return isa::avx512;
+            }
+            if (__builtin_cpu_supports("avx2")){
+                return isa::avx2;
+            }
+            if (__builtin_cpu_supports("sse2")){
+                return isa::sse2;
+            }
+#endif
+            return isa::scalar;
+        }();
+        return level;
+    }
+
+    template <arithmetic T, typename A, typename G, typename Tl>
+    VectorIterator<T, true> find(const vector<T, A, G, Tl> &v, std::type_identity_t<T> value) noexcept{
+        const T *p = v.data();
+        std::size_t n = v.size();
+        return v.begin() + detail::dispatch([&](auto k){ return k.find(p, n, value); });
+    }
+
+    template <arithmetic T, typename A, typename G, typename Tl>
+    VectorIterator<T, false> find(vector<T, A, G, Tl> &v, std::type_identity_t<T> value) noexcept{
+        const T *p = v.data();
+        std::size_t n = v.size();
+        return v.begin() + detail::dispatch([&](auto k){ return k.find(p, n, value); });
+    }
+
+    template <arithmetic T, typename A, typename G, typename Tl>
+    std::size_t count(const vector<T, A, G, Tl> &v, std::type_identity_t<T> value) noexcept{
+        const T *p = v.data();
+        std::size_t n = v.size();
+        return detail::dispatch([&](auto k){ return k.count(p, n, value); });
+    }
+
+    template <arithmetic T, typename A, typename G, typename Tl>
+    bool contains(const vector<T, A, G, Tl> &v, std::type_identity_t<T> value) noexcept{
+        return find(v, value) != v.end();
+    }
+
+    template <arithmetic T, typename A, typename G, typename Tl>
+    T min(const vector<T, A, G, Tl> &v){
+        return minmax(v).first;
+    }
+
+    template <arithmetic T, typename A, typename G, typename Tl>
+    T max(const vector<T, A, G, Tl> &v){
+        return minmax(v).second;
+    }
+
+    template <arithmetic T, typename A, typename G, typename Tl>
+    std::pair<T, T> minmax(const vector<T, A, G, Tl> &v){
+        if (v.empty()){
+            throw std::out_of_range("Vector is empty");
+        }
+        const T *p = v.data();
+        std::size_t n = v.size();
+        return detail::dispatch([&](auto k){ return k.minmax(p, n); });
+    }
+
+    template <arithmetic T, typename A, typename G, typename Tl>
+    sum_type<T> sum(const vector<T, A, G, Tl> &v) noexcept{
+        const T *p = v.data();
+        std::size_t n = v.size();
+        return detail::dispatch([&](auto k){ return k.sum(p, n); });
+    }
+
+    template <arithmetic T, typename A1, typename G1, typename Tl1, typename A2, typename G2, typename Tl2>
+    sum_type<T> dot(const vector<T, A1, G1, Tl1> &a, const vector<T, A2, G2, Tl2> &b){
+        if (a.size() != b.size()){
+            throw std::invalid_argument("Vectors have different sizes");
+        }
+        const T *pa = a.data();
+        const T *pb = b.data();
+        std::size_t n = a.size();
+        return detail::dispatch([&](auto k){ return k.dot(pa, pb, n); });
+    }
+
+    template <arithmetic T, typename A1, typename G1, typename Tl1, typename A2, typename G2, typename Tl2>
+    std::pair<VectorIterator<T, true>, VectorIterator<T, true>>
+    mismatch(const vector<T, A1, G1, Tl1> &a, const vector<T, A2, G2, Tl2> &b) noexcept{
+        const T *pa = a.data();
+        const T *pb = b.data();
+        std::size_t n = std::min(a.size(), b.size());
+        std::size_t i = detail::dispatch([&](auto k){ return k.mismatch(pa, pb, n); });
+        return {a.begin() + i, b.begin() + i};
+    }
+
+    template <arithmetic T, typename A1, typename G1, typename Tl1, typename A2, typename G2, typename Tl2>
+    bool equal(const vector<T, A1, G1, Tl1> &a, const vector<T, A2, G2, Tl2> &b) noexcept{
+        return a.size() == b.size() && mismatch(a, b).first == a.end();
+    }
+}
+
+#endif
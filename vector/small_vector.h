@@ -0,0 +1,289 @@
+#ifndef MYVEC_SMALL_VECTOR_H
+#define MYVEC_SMALL_VECTOR_H
+
+#include "vector.h"
+
+namespace MyVec {
+    /// Аллокатор small_vector: блок ёмкостью до N элементов - встроенный буфер контейнера, если тот свободен,
+    /// остальные блоки выделяются в куче. Аллокаторы разных small_vector не равны, так как ссылаются на разные буферы
+    /// \tparam T Тип хранимых значений
+    /// \tparam N Ёмкость встроенного буфера
+    template <typename T, std::size_t N>
+    class small_buffer_allocator {
+    private:
+        T *buffer = nullptr;
+        bool in_use = false;
+    public:
+        /// Тип хранимых значений
+        using value_type = T;
+
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+        using is_always_equal = std::false_type;
+
+        small_buffer_allocator() noexcept = default;
+
+        /// Конструктор по встроенному буферу, который контейнер сразу использует как свой блок
+        /// \param buffer Встроенный буфер контейнера
+        explicit small_buffer_allocator(T *buffer) noexcept: buffer{buffer}, in_use{true}{}
+
+        /// Выделяет память под n элементов: встроенный буфер, если n <= N и он не занят, иначе память из кучи.
+        /// Занятый буфер не выдаётся повторно: вектор может запросить новый блок, ещё не освободив текущий
+        /// \param n Количество элементов
+        /// \return Указатель на выделенную память
+        [[nodiscard]] T *allocate(std::size_t n){
+            if (buffer && !in_use && n <= N){
+                in_use = true;
+                return buffer;
+            }
+            return std::allocator<T>().allocate(n);
+        }
+
+        /// Освобождает память; встроенный буфер только помечается свободным
+        /// \param p Указатель на память
+        /// \param n Количество элементов, под которое выделялась память
+        void deallocate(T *p, std::size_t n) noexcept{
+            if (p == buffer){
+                in_use = false;
+            } else {
+                std::allocator<T>().deallocate(p, n);
+            }
+        }
+
+        /// Отмечает встроенный буфер занятым или свободным, когда контейнер меняет блок в обход allocate/deallocate
+        /// \param occupied true, если буфер снова хранит элементы контейнера
+        void occupy(bool occupied) noexcept{ in_use = occupied; }
+
+        /// Проверяет, является ли блок встроенным буфером
+        /// \param p Указатель на блок
+        /// \return true, если p - встроенный буфер
+        [[nodiscard]] bool is_inline(const T *p) const noexcept{ return p == buffer; }
+
+        /// Копия контейнера не может пользоваться чужим встроенным буфером, поэтому копия аллокатора работает с кучей
+        /// \return Аллокатор без встроенного буфера
+        [[nodiscard]] small_buffer_allocator select_on_container_copy_construction() const noexcept{ return {}; }
+
+        bool operator==(const small_buffer_allocator &other) const noexcept{ return buffer == other.buffer; }
+    };
+
+    /// Вектор со встроенным буфером на N элементов: пока размер не превышает N, память в куче не выделяется.
+    /// Интерфейс и итераторы совпадают с vector
+    /// \tparam T Тип хранимых значений
+    /// \tparam N Ёмкость встроенного буфера
+    template <typename T, std::size_t N>
+    class small_vector : public vector<T, small_buffer_allocator<T, N>> {
+        static_assert(N > 0, "small_vector requires a non-empty inline buffer");
+    private:
+        using base = vector<T, small_buffer_allocator<T, N>>;
+
+        alignas(T) std::byte storage[N * sizeof(T)];
+
+        T *inline_buffer() noexcept{ return reinterpret_cast<T *>(storage); }
+        void steal(small_vector &second) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        // Обмен базовых частей поменял бы местами указатели на встроенные буферы, поэтому он скрыт
+        using base::swap;
+    public:
+        using typename base::size_type;
+        using typename base::iterator;
+        using typename base::const_iterator;
+
+        /// Ёмкость встроенного буфера
+        static constexpr size_type inline_capacity = N;
+
+        /// Пустой конструктор, создаёт пустой вектор со встроенным буфером
+        /// (адрес буфера берётся напрямую из storage: функции-члены до конструирования базы вызывать нельзя)
+        small_vector() noexcept: base(reinterpret_cast<T *>(storage), N,
+                                      small_buffer_allocator<T, N>(reinterpret_cast<T *>(storage))){}
+
+        /// Конструктор, заполняющий вектор n копиями T()
+        /// \param size Количество элементов
+        explicit small_vector(size_type size) requires std::default_initializable<T>;
+
+        /// Конструктор, заполняющий вектор n копиями el
+        /// \param size Количество элементов
+        /// \param el Значение элемента, которым будет заполнен вектор
+        small_vector(size_type size, const T &el) requires std::copy_constructible<T>;
+
+        /// Конструктор, заполняющий вектор элементами из списка инициализации
+        /// \param list inisializer_list, из которого будут скопированы значения
+        small_vector(std::initializer_list<T> list) requires std::copy_constructible<T>;
+
+        /// Копирующий конструктор
+        /// \param second Другой вектор
+        small_vector(const small_vector &second) requires std::copy_constructible<T>;
+
+        /// Перемещающий конструктор. Буфер из кучи забирается целиком, встроенные элементы перемещаются поштучно
+        /// \param second Другой вектор
+        small_vector(small_vector &&second) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        /// Оператор присваивания копированием
+        /// \param second Другой вектор
+        /// \return Ссылка на текущий вектор после присваивания
+        small_vector &operator=(const small_vector &second) requires std::copy_constructible<T>;
+
+        /// Оператор присваивания перемещением
+        /// \param second Другой вектор
+        /// \return Ссылка на текущий вектор после присваивания
+        small_vector &operator=(small_vector &&second) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        /// Оператор присваивания из списка инициализации
+        /// \param list inisializer_list, из которого будут скопированы значения
+        /// \return Ссылка на текущий вектор после присваивания
+        small_vector &operator=(std::initializer_list<T> list) requires std::copy_constructible<T>;
+
+        /// Деструктор. Элементы разрушаются, пока встроенный буфер ещё существует
+        ~small_vector(){ this->clear(); }
+
+        /// Проверяет, хранятся ли элементы во встроенном буфере
+        /// \return true, если память из кучи не используется
+        [[nodiscard]] bool is_inline() const noexcept{ return this->alloc.is_inline(this->array); }
+
+        /// Обменивает содержимое двух векторов с учётом того, где хранятся элементы каждого из них
+        /// \param second Другой вектор
+        void swap(small_vector &second) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                 std::is_nothrow_swappable_v<T>);
+
+        /// Обменивает содержимое двух векторов (находится ADL вместо поэлементного std::swap)
+        friend void swap(small_vector &first, small_vector &second) noexcept(noexcept(first.swap(second))){
+            first.swap(second);
+        }
+    };
+}
+
+namespace MyVec {
+    template <typename T, std::size_t N>
+    small_vector<T, N>::small_vector(size_type size) requires std::default_initializable<T>: small_vector(){
+        this->reserve(size);
+        for (size_type i = 0; i < size; i++){
+            this->emplace_back();
+        }
+    }
+
+    template <typename T, std::size_t N>
+    small_vector<T, N>::small_vector(size_type size, const T &el) requires std::copy_constructible<T>: small_vector(){
+        this->reserve(size);
+        for (size_type i = 0; i < size; i++){
+            this->push_back(el);
+        }
+    }
+
+    template <typename T, std::size_t N>
+    small_vector<T, N>::small_vector(std::initializer_list<T> list) requires std::copy_constructible<T>: small_vector(){
+        this->reserve(list.size());
+        for (const T &element: list){
+            this->push_back(element);
+        }
+    }
+
+    template <typename T, std::size_t N>
+    small_vector<T, N>::small_vector(const small_vector &second) requires std::copy_constructible<T>: small_vector(){
+        this->reserve(second.size());
+        for (const T &element: second){
+            this->push_back(element);
+        }
+    }
+
+    template <typename T, std::size_t N>
+    small_vector<T, N>::small_vector(small_vector &&second) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : small_vector(){
+        steal(second);
+    }
+
+    template <typename T, std::size_t N>
+    small_vector<T, N> &small_vector<T, N>::operator=(const small_vector &second) requires std::copy_constructible<T>{
+        if (this != &second){
+            this->clear();
+            this->reserve(second.size());
+            for (const T &element: second){
+                this->push_back(element);
+            }
+        }
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    small_vector<T, N> &small_vector<T, N>::operator=(small_vector &&second)
+    noexcept(std::is_nothrow_move_constructible_v<T>){
+        if (this != &second){
+            this->clear();
+            this->deallocate();
+            this->array = inline_buffer();
+            this->_capacity = N;
+            this->alloc.occupy(true);
+            steal(second);
+        }
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    small_vector<T, N> &small_vector<T, N>::operator=(std::initializer_list<T> list) requires std::copy_constructible<T>{
+        this->clear();
+        this->reserve(list.size());
+        for (const T &element: list){
+            this->push_back(element);
+        }
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    void small_vector<T, N>::steal(small_vector &second) noexcept(std::is_nothrow_move_constructible_v<T>){
+        // Ожидается пустой вектор со встроенным буфером
+        if (second.is_inline()){
+            this->relocate(second.array, second._size, this->array);
+            this->_size = second._size;
+            second._size = 0;
+            return;
+        }
+        this->array = second.array;
+        this->_size = second._size;
+        this->_capacity = second._capacity;
+        this->alloc.occupy(false);
+        second.array = second.inline_buffer();
+        second._size = 0;
+        second._capacity = N;
+        second.alloc.occupy(true);
+    }
+
+    template <typename T, std::size_t N>
+    void small_vector<T, N>::swap(small_vector &second) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                 std::is_nothrow_swappable_v<T>){
+        if (this == &second){
+            return;
+        }
+        if (!is_inline() && !second.is_inline()){
+            std::swap(this->array, second.array);
+            std::swap(this->_size, second._size);
+            std::swap(this->_capacity, second._capacity);
+            return;
+        }
+        if (is_inline() && second.is_inline()){
+            small_vector &larger = this->_size >= second._size ? *this : second;
+            small_vector &smaller = this->_size >= second._size ? second : *this;
+            size_type common = smaller._size;
+            std::swap_ranges(larger.array, larger.array + common, smaller.array);
+            this->relocate(larger.array + common, larger._size - common, smaller.array + common);
+            std::swap(this->_size, second._size);
+            return;
+        }
+        // Один вектор в куче, другой во встроенном буфере: буфер из кучи передаётся,
+        // встроенные элементы переносятся во встроенный буфер второго вектора
+        small_vector &heap = is_inline() ? second : *this;
+        small_vector &local = is_inline() ? *this : second;
+        T *heapArray = heap.array;
+        size_type heapSize = heap._size;
+        size_type heapCapacity = heap._capacity;
+        this->relocate(local.array, local._size, heap.inline_buffer());
+        heap.array = heap.inline_buffer();
+        heap._size = local._size;
+        heap._capacity = N;
+        heap.alloc.occupy(true);
+        local.array = heapArray;
+        local._size = heapSize;
+        local._capacity = heapCapacity;
+        local.alloc.occupy(false);
+    }
+}
+
+#endif
@@ -0,0 +1,650 @@
+#ifndef MYVEC_SOA_VECTOR_H
+#define MYVEC_SOA_VECTOR_H
+
+#include <tuple>
+#include <utility>
+#include "vector.h"
+
+namespace MyVec {
+    /// Ссылка на строку soa_vector: набор ссылок на элементы всех столбцов с одинаковым индексом.
+    /// Присваивание записывает значения в столбцы, поэтому алгоритмы вроде std::sort переставляют строки целиком
+    /// \tparam Ts Типы столбцов (для константной ссылки - const Ts)
+    template <typename ...Ts>
+    class soa_reference {
+    private:
+        std::tuple<Ts &...> refs;
+
+        template <typename Tuple, std::size_t ...I>
+        void assign(Tuple &&values, std::index_sequence<I...>) const{
+            ((std::get<I>(refs) = std::get<I>(std::forward<Tuple>(values))), ...);
+        }
+    public:
+        /// Конструктор по ссылкам на элементы
+        /// \param refs Ссылки на элементы столбцов
+        explicit soa_reference(Ts &... refs) noexcept: refs{refs...}{}
+
+        soa_reference(const soa_reference &) noexcept = default;
+
+        /// Копирует значения другой строки
+        /// \param second Другая строка
+        /// \return Ссылка на эту строку
+        const soa_reference &operator=(const soa_reference &second) const
+        requires (!std::is_const_v<Ts> && ...){
+            assign(second.refs, std::index_sequence_for<Ts...>{});
+            return *this;
+        }
+
+        /// Записывает значения кортежа в строку
+        /// \param values Значения столбцов
+        /// \return Ссылка на эту строку
+        const soa_reference &operator=(const std::tuple<std::remove_const_t<Ts>...> &values) const
+        requires (!std::is_const_v<Ts> && ...){
+            assign(values, std::index_sequence_for<Ts...>{});
+            return *this;
+        }
+
+        /// Перемещает значения кортежа в строку
+        /// \param values Значения столбцов
+        /// \return Ссылка на эту строку
+        const soa_reference &operator=(std::tuple<std::remove_const_t<Ts>...> &&values) const
+        requires (!std::is_const_v<Ts> && ...){
+            assign(std::move(values), std::index_sequence_for<Ts...>{});
+            return *this;
+        }
+
+        /// Копирует значения строки в кортеж
+        operator std::tuple<std::remove_const_t<Ts>...>() const{ return std::apply(
+                    [](Ts &... values){ return std::tuple<std::remove_const_t<Ts>...>(values...); }, refs); }
+
+        /// Копирует значения строки в кортеж, часть полей которого константна - тип значения итератора
+        /// с неизменяемыми столбцами (например, ключи flat_map)
+        template <typename ...Us>
+        requires (sizeof...(Us) == sizeof...(Ts)) && (std::is_same_v<std::remove_const_t<Us>, std::remove_const_t<Ts>> && ...)
+                 && (!std::is_same_v<std::tuple<Us...>, std::tuple<std::remove_const_t<Ts>...>>)
+        operator std::tuple<Us...>() const{
+            return std::apply([](Ts &... values){ return std::tuple<Us...>(values...); }, refs);
+        }
+
+        /// Возвращает ссылку на элемент столбца I
+        /// \tparam I Индекс столбца
+        /// \return Ссылка на элемент
+        template <std::size_t I>
+        std::tuple_element_t<I, std::tuple<Ts...>> &get() const noexcept{ return std::get<I>(refs); }
+
+        /// Обменивает значения двух строк
+        friend void swap(const soa_reference &first, const soa_reference &second)
+        requires (!std::is_const_v<Ts> && ...){
+            std::apply([&second](Ts &... a){
+                std::apply([&a...](Ts &... b){
+                    using std::swap;
+                    (swap(a, b), ...);
+                }, second.refs);
+            }, first.refs);
+        }
+
+        template <typename ...Us>
+        bool operator==(const soa_reference<Us...> &second) const{
+            return std::tuple<const Ts &...>(refs) == second.as_tuple();
+        }
+
+        bool operator==(const std::tuple<std::remove_const_t<Ts>...> &values) const{
+            return std::tuple<const Ts &...>(refs) == values;
+        }
+
+        /// Кортеж константных ссылок на элементы строки
+        std::tuple<const Ts &...> as_tuple() const noexcept{ return refs; }
+    };
+
+    /// Возвращает ссылку на элемент столбца I строки (находится ADL, как std::get для кортежа)
+    /// \tparam I Индекс столбца
+    /// \param row Строка
+    /// \return Ссылка на элемент
+    template <std::size_t I, typename ...Ts>
+    std::tuple_element_t<I, std::tuple<Ts...>> &get(const soa_reference<Ts...> &row) noexcept{
+        return row.template get<I>();
+    }
+
+    /// Итератор soa_vector: позиция строки, разыменование даёт soa_reference на элементы всех столбцов
+    /// \tparam is_const итератор является const_iterator если true, обычным iterator в ином случае
+    /// \tparam Ts Типы столбцов
+    template <bool is_const, typename ...Ts>
+    class SoaIterator {
+    private:
+        template <typename T>
+        using column_pointer = std::conditional_t<is_const, const T *, T *>;
+
+        std::tuple<column_pointer<Ts>...> columns{};
+        std::ptrdiff_t index = 0;
+    public:
+        /// Категория итератора
+        using iterator_category = std::random_access_iterator_tag;
+
+        /// Концепт итератора
+        using iterator_concept = std::random_access_iterator_tag;
+
+        /// Значение строки
+        using value_type = std::tuple<Ts...>;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Тип ссылки на строку
+        using reference = std::conditional_t<is_const, soa_reference<const Ts...>, soa_reference<Ts...>>;
+
+        /// Пустой конструктор
+        SoaIterator() noexcept = default;
+
+        /// Конструктор по началам столбцов и индексу строки
+        /// \param columns Указатели на начала столбцов
+        /// \param index Индекс строки
+        SoaIterator(std::tuple<column_pointer<Ts>...> columns, std::ptrdiff_t index) noexcept
+                : columns{columns}, index{index}{}
+
+        /// Преобразование iterator в const_iterator
+        /// \param other Неконстантный итератор
+        template <bool other_const>
+        SoaIterator(const SoaIterator<other_const, Ts...> &other) noexcept requires (is_const && !other_const)
+                : columns{other.columns}, index{other.index}{}
+
+        reference operator*() const noexcept{
+            return std::apply([this](auto *... column){ return reference(column[index]...); }, columns);
+        }
+
+        reference operator[](difference_type n) const noexcept{ return *(*this + n); }
+
+        SoaIterator &operator++() noexcept{
+            ++index;
+            return *this;
+        }
+
+        SoaIterator operator++(int) noexcept{
+            SoaIterator tmp = *this;
+            ++index;
+            return tmp;
+        }
+
+        SoaIterator &operator--() noexcept{
+            --index;
+            return *this;
+        }
+
+        SoaIterator operator--(int) noexcept{
+            SoaIterator tmp = *this;
+            --index;
+            return tmp;
+        }
+
+        SoaIterator &operator+=(difference_type n) noexcept{
+            index += n;
+            return *this;
+        }
+
+        SoaIterator &operator-=(difference_type n) noexcept{
+            index -= n;
+            return *this;
+        }
+
+        friend SoaIterator operator+(SoaIterator it, difference_type n) noexcept{ return it += n; }
+
+        friend SoaIterator operator+(difference_type n, SoaIterator it) noexcept{ return it += n; }
+
+        friend SoaIterator operator-(SoaIterator it, difference_type n) noexcept{ return it -= n; }
+
+        friend difference_type operator-(const SoaIterator &a, const SoaIterator &b) noexcept{ return a.index - b.index; }
+
+        bool operator==(const SoaIterator &other) const noexcept{ return index == other.index; }
+
+        auto operator<=>(const SoaIterator &other) const noexcept{ return index <=> other.index; }
+
+        /// Индекс строки, на которую указывает итератор
+        [[nodiscard]] difference_type position() const noexcept{ return index; }
+
+        friend class SoaIterator<!is_const, Ts...>;
+    };
+
+    /// Вектор строк из нескольких полей, хранящий каждое поле отдельным непрерывным столбцом (structure of arrays).
+    /// Все столбцы лежат в одном блоке памяти; при росте переносятся за один проход
+    /// \tparam Ts Типы столбцов
+    template <typename ...Ts>
+    class soa_vector {
+        static_assert(sizeof...(Ts) > 0, "soa_vector requires at least one column");
+    public:
+        /// Тип итератора
+        using iterator = SoaIterator<false, Ts...>;
+
+        /// Тип константного итератора
+        using const_iterator = SoaIterator<true, Ts...>;
+
+        /// Значение строки
+        using value_type = std::tuple<Ts...>;
+
+        /// Ссылка на строку
+        using reference = soa_reference<Ts...>;
+
+        /// Константная ссылка на строку
+        using const_reference = soa_reference<const Ts...>;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+
+        /// Тип столбца I
+        template <std::size_t I>
+        using column_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+    private:
+        static constexpr std::size_t alignment = std::max({alignof(Ts)...});
+        using indices = std::index_sequence_for<Ts...>;
+
+        size_type _size = 0;
+        size_type _capacity = 0;
+        void *block = nullptr;
+        std::tuple<Ts *...> columns{};
+
+        static std::size_t block_size(size_type capacity) noexcept;
+        static std::tuple<Ts *...> layout(void *block, size_type capacity) noexcept;
+        template <typename F>
+        static void for_each_column(F &&f);
+        template <typename ...Args>
+        void construct_row(size_type index, Args &&... args);
+        void destroy_rows(size_type from, size_type to) noexcept;
+        void grow_to(size_type required);
+    public:
+        /// Пустой конструктор
+        soa_vector() noexcept = default;
+
+        /// Конструктор, заполняющий вектор строками из списка инициализации
+        /// \param list Список строк
+        soa_vector(std::initializer_list<std::tuple<Ts...>> list);
+
+        /// Копирующий конструктор
+        /// \param second Другой вектор
+        soa_vector(const soa_vector &second);
+
+        /// Перемещающий конструктор
+        /// \param second Другой вектор
+        soa_vector(soa_vector &&second) noexcept{ swap(second); }
+
+        /// Оператор присваивания копированием
+        /// \param second Другой вектор
+        /// \return Ссылка на текущий вектор после присваивания
+        soa_vector &operator=(const soa_vector &second);
+
+        /// Оператор присваивания перемещением
+        /// \param second Другой вектор
+        /// \return Ссылка на текущий вектор после присваивания
+        soa_vector &operator=(soa_vector &&second) noexcept;
+
+        /// Деструктор
+        ~soa_vector();
+
+        /// Оператор доступа к строке по индексу
+        /// \param index Индекс строки
+        /// \return Ссылка на строку
+        [[nodiscard]] reference operator[](size_type index) noexcept{ return begin()[index]; }
+
+        /// Оператор доступа к строке по индексу (константная версия)
+        /// \param index Индекс строки
+        /// \return Константная ссылка на строку
+        [[nodiscard]] const_reference operator[](size_type index) const noexcept{ return begin()[index]; }
+
+        /// Возвращает ссылку на строку с проверкой индекса
+        /// \param index Индекс строки
+        /// \return Ссылка на строку
+        reference at(size_type index);
+
+        /// Возвращает ссылку на строку с проверкой индекса (константная версия)
+        /// \param index Индекс строки
+        /// \return Константная ссылка на строку
+        const_reference at(size_type index) const;
+
+        /// Возвращает столбец I
+        /// \tparam I Индекс столбца
+        /// \return Элементы столбца
+        template <std::size_t I>
+        [[nodiscard]] std::span<column_type<I>> column() noexcept{ return {std::get<I>(columns), _size}; }
+
+        /// Возвращает столбец I (константная версия)
+        /// \tparam I Индекс столбца
+        /// \return Элементы столбца
+        template <std::size_t I>
+        [[nodiscard]] std::span<const column_type<I>> column() const noexcept{ return {std::get<I>(columns), _size}; }
+
+        /// Возвращает размер вектора (количество строк)
+        /// \return Размер вектора
+        [[nodiscard]] size_type size() const noexcept{ return _size; }
+
+        /// Возвращает текущую ёмкость вектора
+        /// \return Текущая ёмкость вектора
+        [[nodiscard]] size_type capacity() const noexcept{ return _capacity; }
+
+        /// Проверяет, является ли вектор пустым
+        /// \return true, если вектор пуст, иначе false
+        [[nodiscard]] bool empty() const noexcept{ return _size == 0; }
+
+        /// Увеличивает ёмкость всех столбцов до указанной величины
+        /// \param newCap Новая ёмкость вектора
+        void reserve(size_type newCap);
+
+        /// Добавляет строку в конец вектора
+        /// \param row Значения столбцов
+        void push_back(const std::tuple<Ts...> &row);
+
+        /// Добавляет строку в конец вектора, перемещая значения
+        /// \param row Значения столбцов
+        void push_back(std::tuple<Ts...> &&row);
+
+        /// Конструирует строку в конце вектора: каждый столбец из своего аргумента
+        /// \param args Аргументы, по одному на столбец
+        template <typename ...Args>
+        requires (sizeof...(Args) == sizeof...(Ts)) && (std::constructible_from<Ts, Args> && ...)
+        void emplace_back(Args &&... args);
+
+        /// Удаляет последнюю строку
+        void pop_back() noexcept;
+
+        /// Удаляет строку
+        /// \param it Итератор на удаляемую строку
+        /// \return Итератор на строку, следующую за удалённой
+        iterator erase(iterator it);
+
+        /// Удаляет все строки
+        void clear() noexcept;
+
+        /// Возвращает итератор на начало вектора
+        /// \return Итератор на начало
+        iterator begin() noexcept{ return iterator(columns, 0); }
+
+        /// Возвращает итератор на конец вектора
+        /// \return Итератор на конец
+        iterator end() noexcept{ return iterator(columns, static_cast<difference_type>(_size)); }
+
+        /// Возвращает константный итератор на начало вектора
+        /// \return Константный итератор на начало
+        const_iterator begin() const noexcept{ return const_iterator(columns, 0); }
+
+        /// Возвращает константный итератор на конец вектора
+        /// \return Константный итератор на конец
+        const_iterator end() const noexcept{ return const_iterator(columns, static_cast<difference_type>(_size)); }
+
+        /// Возвращает константный итератор на начало вектора
+        /// \return Константный итератор на начало
+        const_iterator cbegin() const noexcept{ return begin(); }
+
+        /// Возвращает константный итератор на конец вектора
+        /// \return Константный итератор на конец
+        const_iterator cend() const noexcept{ return end(); }
+
+        /// Обменивает содержимое двух векторов
+        /// \param second Другой вектор
+        void swap(soa_vector &second) noexcept;
+    };
+}
+
+namespace std {
+    template <typename ...Ts>
+    struct tuple_size<MyVec::soa_reference<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+    template <std::size_t I, typename ...Ts>
+    struct tuple_element<I, MyVec::soa_reference<Ts...>> {
+        using type = std::tuple_element_t<I, std::tuple<Ts...>> &;
+    };
+
+    /// Общий тип ссылки на строку и значения строки - значение, чтобы итератор soa_vector
+    /// удовлетворял std::indirectly_readable
+    template <typename ...Ts, typename ...Us, template <typename> class TQual, template <typename> class UQual>
+    requires (sizeof...(Ts) == sizeof...(Us))
+    struct basic_common_reference<MyVec::soa_reference<Ts...>, std::tuple<Us...>, TQual, UQual> {
+        using type = std::tuple<Us...>;
+    };
+
+    template <typename ...Ts, typename ...Us, template <typename> class TQual, template <typename> class UQual>
+    requires (sizeof...(Ts) == sizeof...(Us))
+    struct basic_common_reference<std::tuple<Us...>, MyVec::soa_reference<Ts...>, TQual, UQual> {
+        using type = std::tuple<Us...>;
+    };
+}
+
+namespace MyVec {
+    template <typename ...Ts>
+    std::size_t soa_vector<Ts...>::block_size(size_type capacity) noexcept{
+        std::size_t bytes = 0;
+        ((bytes = (bytes + alignof(Ts) - 1) / alignof(Ts) * alignof(Ts) + capacity * sizeof(Ts)), ...);
+        return bytes;
+    }
+
+    template <typename ...Ts>
+    std::tuple<Ts *...> soa_vector<Ts...>::layout(void *block, size_type capacity) noexcept{
+        auto *base = static_cast<std::byte *>(block);
+        std::size_t offset = 0;
+        auto place = [&]<typename T>(std::type_identity<T>){
+            offset = (offset + alignof(T) - 1) / alignof(T) * alignof(T);
+            T *column = reinterpret_cast<T *>(base + offset);
+            offset += capacity * sizeof(T);
+            return column;
+        };
+        // Список инициализации гарантирует порядок вычисления слева направо
+        return std::tuple<Ts *...>{place(std::type_identity<Ts>{})...};
+    }
+
+    template <typename ...Ts>
+    template <typename F>
+    void soa_vector<Ts...>::for_each_column(F &&f){
+        [&f]<std::size_t ...I>(std::index_sequence<I...>){
+            (f(std::integral_constant<std::size_t, I>{}), ...);
+        }(indices{});
+    }
+
+    template <typename ...Ts>
+    soa_vector<Ts...>::soa_vector(std::initializer_list<std::tuple<Ts...>> list){
+        reserve(list.size());
+        for (const std::tuple<Ts...> &row: list){
+            push_back(row);
+        }
+    }
+
+    template <typename ...Ts>
+    soa_vector<Ts...>::soa_vector(const soa_vector &second){
+        reserve(second._size);
+        for (size_type i = 0; i < second._size; i++){
+            std::apply([this](const Ts &... values){ construct_row(_size, values...); }, second[i].as_tuple());
+            _size++;
+        }
+    }
+
+    template <typename ...Ts>
+    soa_vector<Ts...> &soa_vector<Ts...>::operator=(const soa_vector &second){
+        if (this != &second){
+            soa_vector copy(second);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template <typename ...Ts>
+    soa_vector<Ts...> &soa_vector<Ts...>::operator=(soa_vector &&second) noexcept{
+        if (this != &second){
+            soa_vector moved(std::move(second));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    template <typename ...Ts>
+    soa_vector<Ts...>::~soa_vector(){
+        clear();
+        if (block){
+            ::operator delete(block, std::align_val_t{alignment});
+        }
+    }
+
+    template <typename ...Ts>
+    soa_reference<Ts...> soa_vector<Ts...>::at(size_type index){
+        if (index >= _size){
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    template <typename ...Ts>
+    soa_reference<const Ts...> soa_vector<Ts...>::at(size_type index) const{
+        if (index >= _size){
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    template <typename ...Ts>
+    void soa_vector<Ts...>::reserve(size_type newCap){
+        if (newCap <= _capacity){
+            return;
+        }
+        void *newBlock = ::operator new(block_size(newCap), std::align_val_t{alignment});
+        std::tuple<Ts *...> newColumns = layout(newBlock, newCap);
+
+        // Сначала копируются столбцы с бросающим перемещением: при исключении старый блок ещё цел
+        std::size_t copied = 0;
+        try {
+            for_each_column([&](auto i){
+                using T = column_type<i>;
+                if constexpr (!is_trivially_relocatable_v<T> && !std::is_nothrow_move_constructible_v<T>){
+                    if constexpr (std::is_copy_constructible_v<T>){
+                        std::uninitialized_copy_n(std::get<i>(columns), _size, std::get<i>(newColumns));
+                    } else {
+                        std::uninitialized_move_n(std::get<i>(columns), _size, std::get<i>(newColumns));
+                    }
+                }
+                copied = i + 1;
+            });
+        } catch (...){
+            for_each_column([&](auto i){
+                using T = column_type<i>;
+                if constexpr (!is_trivially_relocatable_v<T> && !std::is_nothrow_move_constructible_v<T>){
+                    if (i < copied){
+                        std::destroy_n(std::get<i>(newColumns), _size);
+                    }
+                }
+            });
+            ::operator delete(newBlock, std::align_val_t{alignment});
+            throw;
+        }
+
+        // Остальные столбцы переносятся без исключений, затем старые элементы разрушаются
+        for_each_column([&](auto i){
+            using T = column_type<i>;
+            T *from = std::get<i>(columns);
+            T *to = std::get<i>(newColumns);
+            if constexpr (is_trivially_relocatable_v<T>){
+                if (_size){
+                    std::memcpy(static_cast<void *>(to), static_cast<const void *>(from), _size * sizeof(T));
+                }
+                return;
+            } else if constexpr (std::is_nothrow_move_constructible_v<T>){
+                std::uninitialized_move_n(from, _size, to);
+            }
+            std::destroy_n(from, _size);
+        });
+        if (block){
+            ::operator delete(block, std::align_val_t{alignment});
+        }
+        block = newBlock;
+        columns = newColumns;
+        _capacity = newCap;
+    }
+
+    template <typename ...Ts>
+    void soa_vector<Ts...>::grow_to(size_type required){
+        if (required > _capacity){
+            reserve(doubling_growth::next_capacity(_capacity, required, block_size(1)));
+        }
+    }
+
+    template <typename ...Ts>
+    template <typename ...Args>
+    void soa_vector<Ts...>::construct_row(size_type index, Args &&... args){
+        std::size_t constructed = 0;
+        auto values = std::forward_as_tuple(std::forward<Args>(args)...);
+        try {
+            for_each_column([&](auto i){
+                std::construct_at(std::get<i>(columns) + index, std::get<i>(std::move(values)));
+                constructed = i + 1;
+            });
+        } catch (...){
+            for_each_column([&](auto i){
+                if (i < constructed){
+                    std::destroy_at(std::get<i>(columns) + index);
+                }
+            });
+            throw;
+        }
+    }
+
+    template <typename ...Ts>
+    void soa_vector<Ts...>::destroy_rows(size_type from, size_type to) noexcept{
+        for_each_column([&](auto i){
+            std::destroy(std::get<i>(columns) + from, std::get<i>(columns) + to);
+        });
+    }
+
+    template <typename ...Ts>
+    void soa_vector<Ts...>::push_back(const std::tuple<Ts...> &row){
+        std::apply([this](const Ts &... values){ emplace_back(values...); }, row);
+    }
+
+    template <typename ...Ts>
+    void soa_vector<Ts...>::push_back(std::tuple<Ts...> &&row){
+        std::apply([this](Ts &... values){ emplace_back(std::move(values)...); }, row);
+    }
+
+    template <typename ...Ts>
+    template <typename ...Args>
+    requires (sizeof...(Args) == sizeof...(Ts)) && (std::constructible_from<Ts, Args> && ...)
+    void soa_vector<Ts...>::emplace_back(Args &&... args){
+        if (_size == _capacity){
+            // Аргументы могут ссылаться на элементы вектора, поэтому строка собирается до роста
+            std::tuple<Ts...> row(std::forward<Args>(args)...);
+            grow_to(_size + 1);
+            std::apply([this](Ts &... values){ construct_row(_size, std::move(values)...); }, row);
+        } else {
+            construct_row(_size, std::forward<Args>(args)...);
+        }
+        _size++;
+    }
+
+    template <typename ...Ts>
+    void soa_vector<Ts...>::pop_back() noexcept{
+        destroy_rows(_size - 1, _size);
+        _size--;
+    }
+
+    template <typename ...Ts>
+    SoaIterator<false, Ts...> soa_vector<Ts...>::erase(iterator it){
+        auto index = static_cast<size_type>(it.position());
+        if (index >= _size){
+            return end();
+        }
+        for_each_column([&](auto i){
+            auto *column = std::get<i>(columns);
+            std::move(column + index + 1, column + _size, column + index);
+        });
+        pop_back();
+        return begin() + static_cast<difference_type>(index);
+    }
+
+    template <typename ...Ts>
+    void soa_vector<Ts...>::clear() noexcept{
+        destroy_rows(0, _size);
+        _size = 0;
+    }
+
+    template <typename ...Ts>
+    void soa_vector<Ts...>::swap(soa_vector &second) noexcept{
+        std::swap(_size, second._size);
+        std::swap(_capacity, second._capacity);
+        std::swap(block, second.block);
+        std::swap(columns, second.columns);
+    }
+}
+
+#endif
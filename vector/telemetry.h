@@ -0,0 +1,245 @@
+#ifndef MYVEC_TELEMETRY_H
+#define MYVEC_TELEMETRY_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include "vector.h"
+
+namespace MyVec {
+    /// Количество корзин гистограммы роста: корзина k считает рост до ёмкости из [2^k, 2^(k+1))
+    inline constexpr std::size_t telemetry_buckets = 64;
+
+    /// Счётчики одного тега. Обновляются из любых потоков без блокировок
+    struct telemetry_counters {
+        std::atomic<std::uint64_t> allocations{0};
+        std::atomic<std::uint64_t> deallocations{0};
+        std::atomic<std::uint64_t> reallocations{0};
+        std::atomic<std::uint64_t> relocated_elements{0};
+        std::atomic<std::uint64_t> relocated_bytes{0};
+        std::atomic<std::uint64_t> bytes_allocated{0};
+        std::atomic<std::uint64_t> bytes_freed{0};
+        std::atomic<std::uint64_t> peak_capacity{0};
+        std::atomic<std::uint64_t> destroyed{0};
+        std::atomic<std::uint64_t> wasted_capacity{0};
+        std::atomic<std::uint64_t> wasted_bytes{0};
+        std::array<std::atomic<std::uint64_t>, telemetry_buckets> growth{};
+    };
+
+    /// Копия счётчиков тега на момент снятия
+    struct telemetry_snapshot {
+        std::string tag;
+        std::uint64_t allocations = 0;
+        std::uint64_t deallocations = 0;
+        std::uint64_t reallocations = 0;
+        std::uint64_t relocated_elements = 0;
+        std::uint64_t relocated_bytes = 0;
+        std::uint64_t bytes_allocated = 0;
+        std::uint64_t bytes_freed = 0;
+        std::uint64_t peak_capacity = 0;
+        std::uint64_t destroyed = 0;
+        std::uint64_t wasted_capacity = 0;
+        std::uint64_t wasted_bytes = 0;
+        std::array<std::uint64_t, telemetry_buckets> growth{};
+    };
+
+    /// Глобальный реестр счётчиков по тегам. Счётчики тега регистрируются при статической инициализации
+    /// и живут до конца программы; снимок и вывод в JSON можно делать периодически из отдельного потока
+    class telemetry_registry {
+    private:
+        mutable std::mutex mutex;
+        std::multimap<std::string, telemetry_counters *, std::less<>> tags;
+
+        telemetry_registry() = default;
+    public:
+        telemetry_registry(const telemetry_registry &) = delete;
+        telemetry_registry &operator=(const telemetry_registry &) = delete;
+
+        /// Возвращает глобальный реестр
+        /// \return Реестр
+        static telemetry_registry &instance(){
+            static telemetry_registry registry;
+            return registry;
+        }
+
+        /// Регистрирует счётчики тега. Счётчики должны жить до конца программы
+        /// \param tag Имя тега
+        /// \param counters Счётчики
+        void attach(std::string_view tag, telemetry_counters &counters){
+            std::lock_guard lock(mutex);
+            tags.emplace(std::string(tag), &counters);
+        }
+
+        /// Снимает копию счётчиков всех тегов; счётчики тегов с одинаковыми именами складываются
+        /// \return Снимки в порядке имён тегов
+        MyVec::vector<telemetry_snapshot> snapshot() const;
+
+        /// Обнуляет счётчики всех тегов
+        void reset();
+
+        /// Выводит снимок счётчиков в JSON: объект с тегами в качестве ключей.
+        /// Гистограмма роста содержит только непустые корзины, ключ - нижняя граница ёмкости
+        /// \param out Поток вывода
+        void dump_json(std::ostream &out) const;
+    };
+
+    /// Тег для telemetry: тип с именем static constexpr const char *name
+    template <typename Tag>
+    concept telemetry_tag = requires{
+        { Tag::name } -> std::convertible_to<std::string_view>;
+    };
+
+    /// Политика учёта, записывающая события векторов в счётчики тега Tag глобального реестра.
+    /// Векторы одного места вызова получают общий тег, например
+    /// MyVec::vector<int, std::allocator<int>, MyVec::doubling_growth, MyVec::telemetry<parser_tag>>
+    /// \tparam Tag Тег с именем
+    template <telemetry_tag Tag>
+    struct telemetry {
+    private:
+        // Счётчики инициализируются константой, поэтому хуки не выделяют память и не берут блокировку
+        // даже при первом событии, в том числе до main. В реестр они попадают при статической инициализации
+        constinit static inline telemetry_counters storage{};
+        static inline const bool registered = (telemetry_registry::instance().attach(Tag::name, storage), true);
+    public:
+        /// Счётчики тега
+        /// \return Счётчики, зарегистрированные в глобальном реестре
+        static telemetry_counters &counters() noexcept{
+            // Обращение к registered инстанцирует регистрацию для каждого используемого тега
+            static_cast<void>(registered);
+            return storage;
+        }
+
+        static void on_allocate(std::size_t capacity, std::size_t bytes) noexcept{
+            telemetry_counters &c = counters();
+            c.allocations.fetch_add(1, std::memory_order_relaxed);
+            c.bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+            std::uint64_t peak = c.peak_capacity.load(std::memory_order_relaxed);
+            while (peak < capacity && !c.peak_capacity.compare_exchange_weak(peak, capacity, std::memory_order_relaxed)){
+            }
+        }
+
+        static void on_deallocate(std::size_t bytes) noexcept{
+            telemetry_counters &c = counters();
+            c.deallocations.fetch_add(1, std::memory_order_relaxed);
+            c.bytes_freed.fetch_add(bytes, std::memory_order_relaxed);
+        }
+
+        static void on_reallocate(std::size_t, std::size_t newCapacity) noexcept{
+            telemetry_counters &c = counters();
+            c.reallocations.fetch_add(1, std::memory_order_relaxed);
+            c.growth[std::bit_width(newCapacity) - 1].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        static void on_relocate(std::size_t elements, std::size_t bytes) noexcept{
+            if (elements){
+                telemetry_counters &c = counters();
+                c.relocated_elements.fetch_add(elements, std::memory_order_relaxed);
+                c.relocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+            }
+        }
+
+        static void on_destroy(std::size_t size, std::size_t capacity, std::size_t elementSize) noexcept{
+            telemetry_counters &c = counters();
+            c.destroyed.fetch_add(1, std::memory_order_relaxed);
+            c.wasted_capacity.fetch_add(capacity - size, std::memory_order_relaxed);
+            c.wasted_bytes.fetch_add((capacity - size) * elementSize, std::memory_order_relaxed);
+        }
+    };
+}
+
+namespace MyVec {
+    inline MyVec::vector<telemetry_snapshot> telemetry_registry::snapshot() const{
+        std::lock_guard lock(mutex);
+        MyVec::vector<telemetry_snapshot> result;
+        result.reserve(tags.size());
+        for (const auto &[tag, c]: tags){
+            // Разные типы-теги могут носить одно имя: multimap кладёт их подряд
+            if (result.empty() || result.back().tag != tag){
+                telemetry_snapshot fresh;
+                fresh.tag = tag;
+                result.push_back(std::move(fresh));
+            }
+            telemetry_snapshot &s = result.back();
+            s.allocations += c->allocations.load(std::memory_order_relaxed);
+            s.deallocations += c->deallocations.load(std::memory_order_relaxed);
+            s.reallocations += c->reallocations.load(std::memory_order_relaxed);
+            s.relocated_elements += c->relocated_elements.load(std::memory_order_relaxed);
+            s.relocated_bytes += c->relocated_bytes.load(std::memory_order_relaxed);
+            s.bytes_allocated += c->bytes_allocated.load(std::memory_order_relaxed);
+            s.bytes_freed += c->bytes_freed.load(std::memory_order_relaxed);
+            s.peak_capacity = std::max(s.peak_capacity, c->peak_capacity.load(std::memory_order_relaxed));
+            s.destroyed += c->destroyed.load(std::memory_order_relaxed);
+            s.wasted_capacity += c->wasted_capacity.load(std::memory_order_relaxed);
+            s.wasted_bytes += c->wasted_bytes.load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i < telemetry_buckets; i++){
+                s.growth[i] += c->growth[i].load(std::memory_order_relaxed);
+            }
+        }
+        return result;
+    }
+
+    inline void telemetry_registry::reset(){
+        std::lock_guard lock(mutex);
+        for (auto &[tag, c]: tags){
+            for (std::atomic<std::uint64_t> *counter: {&c->allocations, &c->deallocations, &c->reallocations,
+                                                      &c->relocated_elements, &c->relocated_bytes, &c->bytes_allocated,
+                                                      &c->bytes_freed, &c->peak_capacity, &c->destroyed,
+                                                      &c->wasted_capacity, &c->wasted_bytes}){
+                counter->store(0, std::memory_order_relaxed);
+            }
+            for (std::atomic<std::uint64_t> &bucket: c->growth){
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    inline void telemetry_registry::dump_json(std::ostream &out) const{
+        // Имя тега задаёт пользователь, поэтому кавычки, обратная косая черта и управляющие символы экранируются
+        auto quoted = [&out](std::string_view text){
+            static constexpr char hex[] = "0123456789abcdef";
+            out << '"';
+            for (char c: text){
+                if (c == '"' || c == '\\'){
+                    out << '\\' << c;
+                } else if (static_cast<unsigned char>(c) < 0x20){
+                    out << "\\u00" << hex[(c >> 4) & 0xf] << hex[c & 0xf];
+                } else {
+                    out << c;
+                }
+            }
+            out << '"';
+        };
+        out << "{";
+        bool firstTag = true;
+        for (const telemetry_snapshot &s: snapshot()){
+            out << (firstTag ? "\n" : ",\n") << "  ";
+            quoted(s.tag);
+            out << ": {\"allocations\": " << s.allocations
+                << ", \"deallocations\": " << s.deallocations << ", \"reallocations\": " << s.reallocations
+                << ", \"relocated_elements\": " << s.relocated_elements << ", \"relocated_bytes\": " << s.relocated_bytes
+                << ", \"bytes_allocated\": " << s.bytes_allocated << ", \"bytes_freed\": " << s.bytes_freed
+                << ", \"peak_capacity\": " << s.peak_capacity << ", \"destroyed\": " << s.destroyed
+                << ", \"wasted_capacity\": " << s.wasted_capacity << ", \"wasted_bytes\": " << s.wasted_bytes
+                << ", \"growth_histogram\": {";
+            bool firstBucket = true;
+            for (std::size_t i = 0; i < telemetry_buckets; i++){
+                if (s.growth[i]){
+                    out << (firstBucket ? "" : ", ") << "\"" << (std::uint64_t{1} << i) << "\": " << s.growth[i];
+                    firstBucket = false;
+                }
+            }
+            out << "}}";
+            firstTag = false;
+        }
+        out << "\n}" << std::endl;
+    }
+}
+
+#endif
@@ -1,612 +1,1984 @@
-#ifndef MYVECTOR_H
-#define MYVECTOR_H
-
-#include <iostream>
-#include <algorithm>
-#include <iterator>
-
-using std::cout, std::endl;
-namespace MyVec {
-    /// Класс итератора для вектора
-    /// \tparam T адресуемый итератором тип
-    /// \tparam is_const итератор является const_iterator если true, обычным iterator в ином случае
-    template <typename T, bool is_const>
-    class VectorIterator {
-    private:
-        T *ptr;
-    public:
-        /// Категория итератора
-        using iterator_category = std::random_access_iterator_tag;
-
-        /// Адресуемый итератором тип
-        using value_type = T;
-
-        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
-        using difference_type = std::ptrdiff_t;
-
-        /// Тип указателя на хранимое значение, для const_iterator - const T*, для обычного - T*
-        using pointer = T *;
-
-        /// Тип ссылки на хранимое значение, для const_iterator - const T&, для обычного - T&
-        using reference = T &;
-
-        /// Пустой конструктор
-        VectorIterator() noexcept: ptr{nullptr}{};
-
-        /// Конструктор по указателю
-        /// \param p Указатель на значение
-        explicit VectorIterator(T *p) : ptr(p){}
-
-        /// Копирующий конструктор
-        /// \tparam other_const Константность копируемого итератора
-        /// \param other Ссылка на другой итератор
-        template <bool other_const>
-        explicit
-        VectorIterator(const VectorIterator<T, other_const> &other) noexcept requires (is_const <= other_const): ptr{
-                other.ptr}{}
-
-        /// Перемещающий конструктор
-        /// \tparam other_const Константность копируемого итератора
-        /// \param other Другой итератор
-        template <bool other_const>
-        explicit
-        VectorIterator(VectorIterator<T, other_const> &&other) noexcept requires (is_const <= other_const): ptr{
-                other.ptr}{
-            other.ptr = nullptr;
-        }
-
-        /// Копирующее перемещение
-        /// \tparam other_const Константность копируемого итератора
-        /// \param other Другой итератор
-        /// \return Ссылка на переданный итератор
-        template <bool other_const>
-        VectorIterator &
-        operator=(const VectorIterator<T, other_const> &other) noexcept requires (is_const <= other_const){
-            if (this != &other){
-                ptr = other.ptr;
-            }
-            return *this;
-        }
-
-        /// Перемещающее перемещение (-____-)
-        /// \tparam other_const Константность копируемого итератора
-        /// \param other Другой итератор
-        /// \return Ссылка на переданный итератор
-        template <bool other_const>
-        VectorIterator &operator=(VectorIterator<T, other_const> &&other) noexcept requires (is_const <= other_const){
-            if (this != &other){
-                ptr = other.ptr;
-                other.ptr = nullptr;
-            }
-            return *this;
-        }
-
-        /// Передвигает итератор на следующий элемент списка
-        /// \return Ссылка на переданный итератор
-        VectorIterator &operator++() noexcept{
-            ++ptr;
-            return *this;
-        }
-
-        /// Передвигает итератор на следующий элемент списка
-        /// \return Состояние итератора до модификации
-        VectorIterator operator++(int){
-            VectorIterator tmp = *this;
-            ++(*this);
-            return tmp;
-        }
-
-        /// Передвигает итератор на предыдущий элемент списка
-        /// \return Ссылка на переданный итератор
-        VectorIterator &operator--() noexcept{
-            --ptr;
-            return *this;
-        }
-
-        /// Передвигает итератор на предыдущий элемент списка
-        /// \return Состояние итератора до модификации
-        VectorIterator operator--(int){
-            VectorIterator tmp = *this;
-            --(*this);
-            return tmp;
-        }
-
-        /// Разыменование
-        /// \return Ссылка на адресуемый элемент списка
-        reference operator*() const noexcept{ return *ptr; }
-
-        /// Обращение к полям элемента
-        /// \return Указатель на адресуемый элемент списка
-        pointer operator->(){ return ptr; }
-
-        /// Перегрузка оператора "[]" для доступа к элементу по относительному смещению
-        /// \param n Смещение относительно текущего положения итератора
-        /// \return Ссылка на элемент списка с указанным смещением
-        reference operator[](difference_type n){ return *(ptr + n); }
-
-        /// Перегрузка оператора "[]" для доступа к элементу по относительному смещению (константная версия)
-        /// \param n Смещение относительно текущего положения итератора
-        /// \return Ссылка на константный элемент списка с указанным смещением
-        reference operator[](difference_type n) const{ return *(ptr + n); }
-
-        /// Перегрузка оператора "+=" для перемещения итератора на указанное смещение
-        /// \param n Смещение для перемещения итератора
-        /// \return Ссылка на текущий объект итератора после выполнения операции
-        VectorIterator &operator+=(difference_type n){
-            ptr += n;
-            return *this;
-        }
-
-        /// Перегрузка оператора "-=" для перемещения итератора на указанное смещение
-        /// \param n Смещение для перемещения итератора
-        /// \return Ссылка на текущий объект итератора после выполнения операции
-        VectorIterator &operator-=(difference_type n){
-            ptr -= n;
-            return *this;
-        }
-
-        /// Перегрузка оператора "+" для создания нового итератора с указанным смещением
-        /// \param n Смещение для создания нового итератора
-        /// \return Новый итератор, смещенный на указанное значение
-        VectorIterator operator+(difference_type n) const{ return VectorIterator(ptr + n); }
-
-        /// Перегрузка оператора "-" для создания нового итератора с указанным смещением
-        /// \param n Смещение для создания нового итератора
-        /// \return Новый итератор, смещенный на указанное значение
-        VectorIterator operator-(difference_type n) const{ return VectorIterator(ptr - n); }
-
-        /// Перегрузка оператора "+" для вычисления разницы между двумя итераторами
-        /// \param other Другой итератор
-        /// \return Разница в смещении между текущим и переданным итераторами
-        difference_type operator+(const VectorIterator &other) const{ return ptr + other.ptr; }
-
-        /// Перегрузка оператора "-" для вычисления разницы между двумя итераторами
-        /// \param other Другой итератор
-        /// \return Разница в смещении между текущим и переданным итераторами
-        difference_type operator-(const VectorIterator &other) const{ return ptr - other.ptr; }
-
-        /// Перегрузка оператора "+" для создания нового итератора с указанным смещением от начала списка
-        /// \param n Смещение от начала списка
-        /// \param it Итератор, к которому добавляется смещение
-        /// \return Новый итератор, смещенный от начала списка на указанное значение
-        friend VectorIterator operator+(difference_type n, const VectorIterator &it){
-            return VectorIterator(n + it.ptr);
-        }
-
-        /// Перегрузка оператора "-" для создания нового итератора с указанным смещением от начала списка
-        /// \param n Смещение от начала списка
-        /// \param it Итератор, из которого вычитается смещение
-        /// \return Новый итератор, смещенный от начала списка на указанное значение
-        friend VectorIterator operator-(difference_type n, const VectorIterator &it){
-            return VectorIterator(n - it.ptr);
-        }
-
-        /// Перегрузка оператора "<" для сравнения текущего итератора с другим
-        /// \param other Другой итератор
-        /// \return true, если текущий итератор меньше переданного, иначе false
-        bool operator<(const VectorIterator &other) const{ return ptr < other.ptr; }
-
-        /// Перегрузка оператора ">" для сравнения текущего итератора с другим
-        /// \param other Другой итератор
-        /// \return true, если текущий итератор больше переданного, иначе false
-        bool operator>(const VectorIterator &other) const{ return ptr > other.ptr; }
-
-        /// Перегрузка оператора "<=" для сравнения текущего итератора с другим
-        /// \param other Другой итератор
-        /// \return true, если текущий итератор меньше или равен переданному, иначе false
-        bool operator<=(const VectorIterator &other) const{ return ptr <= other.ptr; }
-
-        /// Перегрузка оператора ">=" для сравнения текущего итератора с другим
-        /// \param other Другой итератор
-        /// \return true, если текущий итератор больше или равен переданному, иначе false
-        bool operator>=(const VectorIterator &other) const{ return ptr >= other.ptr; }
-
-        /// Перегрузка оператора "=" для проверки равенства текущего итератора и другого
-        /// \param other Другой итератор
-        /// \return true, если текущий итератор равен переданному, иначе false
-        bool operator==(const VectorIterator &other) const{ return ptr == other.ptr; }
-
-        /// Перегрузка оператора "!=" для проверки неравенства текущего итератора и другого
-        /// \param other Другой итератор
-        /// \return true, если текущий итератор не равен переданному, иначе false
-        bool operator!=(const VectorIterator &other) const{ return !(*this == other); }
-    };
-
-    static_assert(std::random_access_iterator<VectorIterator<std::size_t, false>>);
-    static_assert(std::random_access_iterator<VectorIterator<std::size_t, true>>);
-
-    /// Вектор
-    /// \tparam T Тип хранимых значений
-    template <typename T>
-    class vector {
-        /// Тип итератора
-        using iterator = VectorIterator<T, false>;
-
-        /// Тип константного итератора
-        using const_iterator = VectorIterator<T, true>;
-
-        /// Тип хранимых значений
-        using value_type = T;
-
-        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
-        using difference_type = std::ptrdiff_t;
-
-        /// Тип указателя на хранимое значение, для const_iterator - const T*, для обычного - T*
-        using pointer = T *;
-
-        /// Ссылка на тип хранимых значений
-        using reference = T &;
-
-        /// Константная ссылка на тип хранимых значений
-        using const_reference = const T &;
-
-        /// Тип, используемый для преставления размера контейнера
-        using size_type = std::size_t;
-    private:
-        size_type _size = 0;
-        size_type _capacity = 0;
-        T *array = nullptr;
-        void erase_till_end(iterator pos) noexcept;
-        void swap(vector &second) noexcept;
-    public:
-        /// Пустой конструктор, создаёт пустой вектор
-        vector() noexcept(std::is_nothrow_default_constructible_v<T>) = default;
-
-        /// Конструктор, заполняющий вектор n копиями T()
-        /// \param capacity Количество элементов
-        explicit vector(size_type capacity) requires std::copy_constructible<T>;
-
-        /// Конструктор, заполняющий вектор n копиями el
-        /// \param size Количество элементов
-        /// \param el Значение элемента, которым будет заполнен вектор
-        explicit vector(size_type size, const T &el) requires std::copy_constructible<T>;
-
-        /// Конструктор, заполняющий вектор элементами из списка инициализации
-        /// \param list inisializer_list, из которого будут скопированы значения
-        vector(std::initializer_list<T> list) requires std::move_constructible<T>;
-
-        /// Копирующий конструктор
-        /// \param second Другой вектор
-        vector(const vector &second) requires std::copy_constructible<T>;
-
-        /// Перемещающий конструктор
-        /// \param second Другой вектор
-        vector(vector &&second) noexcept;
-
-        /// Оператор присваивания копированием для вектора
-        /// \param second Другой вектор
-        /// \return Ссылка на текущий вектор после присваивания
-        vector &operator=(const vector &second) requires std::copy_constructible<T>;
-
-        /// Оператор присваивания перемещением для вектора
-        /// \param second Другой вектор
-        /// \return Ссылка на текущий вектор после присваивания
-        vector &operator=(vector &&second) noexcept;
-
-        /// Оператор присваивания из списка инициализации для вектора
-        /// \param list inisializer_list, из которого будут скопированы значения
-        /// \return Ссылка на текущий вектор после присваивания
-        vector &operator=(std::initializer_list<T> list) requires std::move_constructible<T>;
-
-        /// Оператор доступа к элементу вектора по индексу
-        /// \param index Индекс элемента
-        /// \return Ссылка на элемент вектора по указанному индексу
-        [[nodiscard]] T &operator[](size_type index){ return array[index]; };
-
-        /// Оператор доступа к элементу вектора по индексу (константная версия)
-        /// \param index Индекс элемента
-        /// \return Константная ссылка на элемент вектора по указанному индексу
-        [[nodiscard]] const T &operator[](size_type index) const{ return array[index]; };
-
-        /// Возвращает размер вектора (количество элементов)
-        /// \return Размер вектора
-        [[nodiscard]] size_type size() const noexcept{ return _size; };
-
-        /// Возвращает текущую ёмкость вектора
-        /// \return Текущая ёмкость вектора
-        [[nodiscard]] size_type capacity() const noexcept{ return _capacity; };
-
-        /// Проверяет, является ли вектор пустым
-        /// \return true, если вектор пуст, иначе false
-        [[nodiscard]] bool empty() const noexcept{ return _size == 0; };
-
-        /// Увеличивает ёмкость вектора до указанной величины
-        /// \param newCap Новая ёмкость вектора
-        void reserve(size_type newCap);
-
-        /// Возвращает константную ссылку на элемент вектора по указанному индексу с проверкой границ
-        /// \param index Индекс элемента
-        /// \return Константная ссылка на элемент вектора по указанному индексу
-        [[nodiscard]] const T &at(size_type index) const;
-
-        /// Возвращает ссылку на элемент вектора по указанному индексу с проверкой границ
-        /// \param index Индекс элемента
-        /// \return Ссылка на элемент вектора по указанному индексу
-        [[nodiscard]] T &at(size_type index);
-
-        /// Возвращает константную ссылку на первый элемент вектора
-        /// \return Константная ссылка на первый элемент вектора
-        [[nodiscard]] const T &front() const{ return array[0]; };
-
-        /// Возвращает ссылку на первый элемент вектора
-        /// \return Ссылка на первый элемент вектора
-        [[nodiscard]] T &front(){ return array[0]; };
-
-        /// Возвращает константную ссылку на последний элемент вектора
-        /// \return Константная ссылка на последний элемент вектора
-        [[nodiscard]] const T &back() const{ return array[_size - 1]; };
-
-        /// Возвращает ссылку на последний элемент вектора
-        /// \return Ссылка на последний элемент вектора
-        [[nodiscard]] T &back(){ return array[_size - 1]; };
-
-        /// Возвращает указатель на начало массива вектора
-        /// \return Указатель на начало массива вектора
-        [[nodiscard]] const T *data() const{ return array; };
-
-        /// Возвращает указатель на начало массива вектора (константная версия)
-        /// \return Указатель на начало массива вектора
-        [[nodiscard]] T *data(){ return array; };
-
-        /// Копирует элемент в конец вектора
-        /// \param element Добавляемый элемент
-        void push_back(const T &element) requires std::copy_constructible<T>;
-
-        /// Перемещает элемент в конец вектора
-        /// \param element Добавляемый элемент
-        void push_back(T &&element) requires std::move_constructible<T>;
-
-        /// Создает и добавляет элемент в конец вектора
-        /// \tparam Args Типы аргументов для конструирования элемента
-        /// \param args Аргументы для конструирования элемента
-        template <typename ...Args>
-        void emplace_back(Args &&... args) requires std::constructible_from<T, Args...>;
-
-        /// Очищает вектор, вызывая деструктор хранимых объектов и устанавливая размер в 0
-        void clear() noexcept;
-
-        /// Деструктор
-        ~vector();
-
-        /// Получение итератора на начало списка
-        /// \return Итератор, адресующий начало списка
-        iterator begin() noexcept{ return iterator(array); }
-
-        /// Получение итератора на конец списка
-        /// \return Итератор, адресующий конец списка
-        iterator end() noexcept{ return iterator(array + _size); }
-
-        /// Получение константного итератора на начало списка
-        /// \return Итератор, адресующий начало списка
-        const_iterator begin() const noexcept{ return const_iterator(array); }
-
-        /// Получение константного итератора на конец списка
-        /// \return Итератор, адресующий конец списка
-        const_iterator end() const noexcept{ return const_iterator(array + _size); }
-
-        /// Получение константного итератора на начало списка
-        /// \return Итератор, адресующий начало списка
-        const_iterator cbegin() const noexcept{ return const_iterator(array); }
-
-        /// Получение константного итератора на конец списка
-        /// \return Итератор, адресующий конец списка
-        const_iterator cend() const noexcept{ return const_iterator(array + _size); }
-
-        /// Удаляет элемент из вектора по указанному итератору
-        /// \param it Итератор на удаляемый элемент
-        /// \return Итератор на элемент, следующий за удаленным элементом
-        iterator erase(iterator it) noexcept;
-
-        /// Удаляет элементы в диапазоне [first, last) из вектора
-        /// \param first Итератор на начало диапазона
-        /// \param last Итератор на конец диапазона (не включая)
-        /// \return Итератор на элемент, следующий за последним удаленным элементом
-        iterator erase(iterator first, iterator last) noexcept;
-    };
-}
-
-namespace MyVec {
-    template <typename T>
-    using iterator = VectorIterator<T, false>;
-    template <typename T>
-    using const_iterator = VectorIterator<T, true>;
-
-    template <typename T>
-    vector<T>::vector(size_type capacity) requires std::copy_constructible<T>{
-        reserve(capacity);
-        for (size_type i = 0; i < capacity; i++){
-            new(&array[i]) T();
-        }
-        _size = capacity;
-    }
-
-    template <typename T>
-    vector<T>::vector(size_type size, const T &el) requires std::copy_constructible<T>{
-        reserve(size);
-        for (size_type i = 0; i < size; i++){
-            new(&array[i]) T(el);
-        }
-        _size = size;
-    }
-
-    template <typename T>
-    vector<T>::vector(std::initializer_list<T> list) requires std::move_constructible<T>{
-        reserve(list.size());
-
-        size_type i = 0;
-        for (const T &element: list){
-            new(&array[i++]) T(element);
-        }
-        _size = list.size();
-    }
-
-    template <typename T>
-    vector<T>::vector(const vector &second) requires std::copy_constructible<T>{
-        reserve(second.size());
-
-        for (size_type i = 0; i < second._size; i++){
-            new(&array[i]) T(second.array[i]);
-        }
-        _size = second.size();
-    }
-
-    template <typename T>
-    vector<T>::vector(vector &&second) noexcept{
-        swap(second);
-    }
-
-    template <typename T>
-    vector<T> &vector<T>::operator=(const vector<T> &second) requires std::copy_constructible<T>{
-        if (this != &second){
-            clear();
-            reserve(second._capacity);
-
-            for (size_type i = 0; i < second._size; i++){
-                new(&array[i]) T(second.array[i]);
-            }
-            _size = second._size;
-        }
-        return *this;
-    }
-
-    template <typename T>
-    vector<T> &vector<T>::operator=(vector<T> &&second) noexcept{
-        if (this != &second){
-            swap(second);
-        }
-        return *this;
-    }
-
-    template <typename T>
-    vector<T> &vector<T>::operator=(std::initializer_list<T> list) requires std::move_constructible<T>{
-        reserve(list.size());
-
-        size_type i = 0;
-        for (const T &element: list){
-            new(&array[i++]) T(element);
-        }
-        _size = list.size();
-        return *this;
-    }
-
-    template <typename T>
-    void vector<T>::reserve(size_type newCap){
-        if (newCap == 0){
-            newCap = 1;
-        } else if (newCap < _capacity){
-            return;
-        }
-        size_type temp = _size;
-
-        T *buffer = static_cast<T *>(::operator new(newCap * sizeof(T)));
-        for (size_type i = 0; i < _size; i++){
-            new(&buffer[i]) T(std::move(array[i]));
-        }
-        clear();
-        ::operator delete(array, _capacity * sizeof(T));
-        array = std::move(buffer);
-        _capacity = newCap;
-        _size = temp;
-    }
-
-    template <typename T>
-    const T &vector<T>::at(size_type index) const{
-        if (index >= _size){
-            throw std::out_of_range("Index is out of range");
-        }
-        return array[index];
-    }
-
-    template <typename T>
-    T &vector<T>::at(size_type index){
-        if (index >= _size){
-            throw std::out_of_range("Index is out of range");
-        }
-        return array[index];
-    }
-
-    template <typename T>
-    void vector<T>::push_back(const T &element) requires std::copy_constructible<T>{
-        if (_size == _capacity){
-            reserve(_capacity * 2);
-        }
-        new(&array[_size++]) T(std::move(element));
-    }
-
-    template <typename T>
-    void vector<T>::push_back(T &&element) requires std::move_constructible<T>{
-        if (_size == _capacity){
-            reserve(_capacity * 2);
-        }
-        new(&array[_size++]) T(std::move(element));
-    }
-
-    template <typename T>
-    template <typename ...Args>
-    void vector<T>::emplace_back(Args &&... args) requires std::constructible_from<T, Args...>{
-        if (_size == _capacity){
-            reserve(_capacity * 2);
-        }
-        new(&array[_size]) T{std::forward<Args>(args)...};
-        _size++;
-    }
-
-    template <typename T>
-    void vector<T>::clear() noexcept{
-        for (int i = 0; i < _size; ++i){
-            array[i].~T();
-        }
-        _size = 0;
-    }
-
-    template <typename T>
-    vector<T>::~vector(){
-        clear();
-        ::operator delete(array, _capacity * sizeof(T));
-    }
-
-    template <typename T>
-    iterator<T> vector<T>::erase(iterator it) noexcept{
-        if (it >= end()){
-            return end();
-        }
-
-        if (it + 1 != end()){
-            std::move(it + 1, end(), it);
-        }
-
-        array[--_size].~T();
-        return it;
-    }
-
-    template <typename T>
-    iterator<T> vector<T>::erase(iterator first, iterator last) noexcept{
-        if (first != last){
-            if (last != end()){
-                std::move(last, end(), first);
-            }
-            erase_till_end(first + (end() - last));
-        }
-        return first;
-    }
-
-    template <typename T>
-    void vector<T>::erase_till_end(iterator pos) noexcept{
-        size_type num = end() - pos;
-        if (num){
-            for (iterator it = pos; it != end(); ++it){
-                it->~T();
-            }
-            _size -= num;
-        }
-    }
-
-    template <typename T>
-    void vector<T>::swap(vector &second) noexcept{
-        std::swap(array, second.array);
-        std::swap(_size, second._size);
-        std::swap(_capacity, second._capacity);
-    }
-}
-
-#endif
\ No newline at end of file
+#ifndef MYVECTOR_H
+#define MYVECTOR_H
+
+#include <iostream>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <exception>
+#include <stdexcept>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <cerrno>
+#include <sys/mman.h>
+
+using std::cout, std::endl;
+namespace MyVec {
+    /// Класс итератора для вектора
+    /// \tparam T адресуемый итератором тип
+    /// \tparam is_const итератор является const_iterator если true, обычным iterator в ином случае
+    template <typename T, bool is_const>
+    class VectorIterator {
+    private:
+        T *ptr;
+    public:
+        /// Категория итератора
+        using iterator_category = std::random_access_iterator_tag;
+
+        /// Адресуемый итератором тип
+        using value_type = T;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Тип указателя на хранимое значение, для const_iterator - const T*, для обычного - T*
+        using pointer = T *;
+
+        /// Тип ссылки на хранимое значение, для const_iterator - const T&, для обычного - T&
+        using reference = T &;
+
+        /// Пустой конструктор
+        constexpr VectorIterator() noexcept: ptr{nullptr}{};
+
+        /// Конструктор по указателю
+        /// \param p Указатель на значение
+        constexpr explicit VectorIterator(T *p) : ptr(p){}
+
+        /// Копирующий конструктор
+        /// \tparam other_const Константность копируемого итератора
+        /// \param other Ссылка на другой итератор
+        template <bool other_const>
+        constexpr explicit
+        VectorIterator(const VectorIterator<T, other_const> &other) noexcept requires (is_const <= other_const): ptr{
+                other.ptr}{}
+
+        /// Перемещающий конструктор
+        /// \tparam other_const Константность копируемого итератора
+        /// \param other Другой итератор
+        template <bool other_const>
+        constexpr explicit
+        VectorIterator(VectorIterator<T, other_const> &&other) noexcept requires (is_const <= other_const): ptr{
+                other.ptr}{
+            other.ptr = nullptr;
+        }
+
+        /// Копирующее перемещение
+        /// \tparam other_const Константность копируемого итератора
+        /// \param other Другой итератор
+        /// \return Ссылка на переданный итератор
+        template <bool other_const>
+        constexpr VectorIterator &
+        operator=(const VectorIterator<T, other_const> &other) noexcept requires (is_const <= other_const){
+            if (this != &other){
+                ptr = other.ptr;
+            }
+            return *this;
+        }
+
+        /// Перемещающее перемещение (-____-)
+        /// \tparam other_const Константность копируемого итератора
+        /// \param other Другой итератор
+        /// \return Ссылка на переданный итератор
+        template <bool other_const>
+        constexpr VectorIterator &operator=(VectorIterator<T, other_const> &&other) noexcept requires (is_const <= other_const){
+            if (this != &other){
+                ptr = other.ptr;
+                other.ptr = nullptr;
+            }
+            return *this;
+        }
+
+        /// Передвигает итератор на следующий элемент списка
+        /// \return Ссылка на переданный итератор
+        constexpr VectorIterator &operator++() noexcept{
+            ++ptr;
+            return *this;
+        }
+
+        /// Передвигает итератор на следующий элемент списка
+        /// \return Состояние итератора до модификации
+        constexpr VectorIterator operator++(int){
+            VectorIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        /// Передвигает итератор на предыдущий элемент списка
+        /// \return Ссылка на переданный итератор
+        constexpr VectorIterator &operator--() noexcept{
+            --ptr;
+            return *this;
+        }
+
+        /// Передвигает итератор на предыдущий элемент списка
+        /// \return Состояние итератора до модификации
+        constexpr VectorIterator operator--(int){
+            VectorIterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        /// Разыменование
+        /// \return Ссылка на адресуемый элемент списка
+        constexpr reference operator*() const noexcept{ return *ptr; }
+
+        /// Обращение к полям элемента
+        /// \return Указатель на адресуемый элемент списка
+        constexpr pointer operator->(){ return ptr; }
+
+        /// Перегрузка оператора "[]" для доступа к элементу по относительному смещению
+        /// \param n Смещение относительно текущего положения итератора
+        /// \return Ссылка на элемент списка с указанным смещением
+        constexpr reference operator[](difference_type n){ return *(ptr + n); }
+
+        /// Перегрузка оператора "[]" для доступа к элементу по относительному смещению (константная версия)
+        /// \param n Смещение относительно текущего положения итератора
+        /// \return Ссылка на константный элемент списка с указанным смещением
+        constexpr reference operator[](difference_type n) const{ return *(ptr + n); }
+
+        /// Перегрузка оператора "+=" для перемещения итератора на указанное смещение
+        /// \param n Смещение для перемещения итератора
+        /// \return Ссылка на текущий объект итератора после выполнения операции
+        constexpr VectorIterator &operator+=(difference_type n){
+            ptr += n;
+            return *this;
+        }
+
+        /// Перегрузка оператора "-=" для перемещения итератора на указанное смещение
+        /// \param n Смещение для перемещения итератора
+        /// \return Ссылка на текущий объект итератора после выполнения операции
+        constexpr VectorIterator &operator-=(difference_type n){
+            ptr -= n;
+            return *this;
+        }
+
+        /// Перегрузка оператора "+" для создания нового итератора с указанным смещением
+        /// \param n Смещение для создания нового итератора
+        /// \return Новый итератор, смещенный на указанное значение
+        constexpr VectorIterator operator+(difference_type n) const{ return VectorIterator(ptr + n); }
+
+        /// Перегрузка оператора "-" для создания нового итератора с указанным смещением
+        /// \param n Смещение для создания нового итератора
+        /// \return Новый итератор, смещенный на указанное значение
+        constexpr VectorIterator operator-(difference_type n) const{ return VectorIterator(ptr - n); }
+
+        /// Перегрузка оператора "+" для вычисления разницы между двумя итераторами
+        /// \param other Другой итератор
+        /// \return Разница в смещении между текущим и переданным итераторами
+        constexpr difference_type operator+(const VectorIterator &other) const{ return ptr + other.ptr; }
+
+        /// Перегрузка оператора "-" для вычисления разницы между двумя итераторами
+        /// \param other Другой итератор
+        /// \return Разница в смещении между текущим и переданным итераторами
+        constexpr difference_type operator-(const VectorIterator &other) const{ return ptr - other.ptr; }
+
+        /// Перегрузка оператора "+" для создания нового итератора с указанным смещением от начала списка
+        /// \param n Смещение от начала списка
+        /// \param it Итератор, к которому добавляется смещение
+        /// \return Новый итератор, смещенный от начала списка на указанное значение
+        friend constexpr VectorIterator operator+(difference_type n, const VectorIterator &it){
+            return VectorIterator(n + it.ptr);
+        }
+
+        /// Перегрузка оператора "-" для создания нового итератора с указанным смещением от начала списка
+        /// \param n Смещение от начала списка
+        /// \param it Итератор, из которого вычитается смещение
+        /// \return Новый итератор, смещенный от начала списка на указанное значение
+        friend constexpr VectorIterator operator-(difference_type n, const VectorIterator &it){
+            return VectorIterator(n - it.ptr);
+        }
+
+        /// Перегрузка оператора "<" для сравнения текущего итератора с другим
+        /// \param other Другой итератор
+        /// \return true, если текущий итератор меньше переданного, иначе false
+        constexpr bool operator<(const VectorIterator &other) const{ return ptr < other.ptr; }
+
+        /// Перегрузка оператора ">" для сравнения текущего итератора с другим
+        /// \param other Другой итератор
+        /// \return true, если текущий итератор больше переданного, иначе false
+        constexpr bool operator>(const VectorIterator &other) const{ return ptr > other.ptr; }
+
+        /// Перегрузка оператора "<=" для сравнения текущего итератора с другим
+        /// \param other Другой итератор
+        /// \return true, если текущий итератор меньше или равен переданному, иначе false
+        constexpr bool operator<=(const VectorIterator &other) const{ return ptr <= other.ptr; }
+
+        /// Перегрузка оператора ">=" для сравнения текущего итератора с другим
+        /// \param other Другой итератор
+        /// \return true, если текущий итератор больше или равен переданному, иначе false
+        constexpr bool operator>=(const VectorIterator &other) const{ return ptr >= other.ptr; }
+
+        /// Перегрузка оператора "=" для проверки равенства текущего итератора и другого
+        /// \param other Другой итератор
+        /// \return true, если текущий итератор равен переданному, иначе false
+        constexpr bool operator==(const VectorIterator &other) const{ return ptr == other.ptr; }
+
+        /// Перегрузка оператора "!=" для проверки неравенства текущего итератора и другого
+        /// \param other Другой итератор
+        /// \return true, если текущий итератор не равен переданному, иначе false
+        constexpr bool operator!=(const VectorIterator &other) const{ return !(*this == other); }
+    };
+
+    static_assert(std::random_access_iterator<VectorIterator<std::size_t, false>>);
+    static_assert(std::random_access_iterator<VectorIterator<std::size_t, true>>);
+
+    /// Признак тривиальной перемещаемости: перенос объекта в другое место памяти с последующим
+    /// отказом от старой копии (без вызова деструктора) эквивалентен побайтовому копированию.
+    /// Для пользовательских типов включается специализацией:
+    /// template <> struct MyVec::is_trivially_relocatable<Type> : std::true_type {};
+    /// \tparam T Проверяемый тип
+    template <typename T>
+    struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+    template <typename T>
+    struct is_trivially_relocatable<std::shared_ptr<T>> : std::true_type {};
+
+    template <typename T>
+    struct is_trivially_relocatable<std::weak_ptr<T>> : std::true_type {};
+
+    template <typename T, typename D>
+    struct is_trivially_relocatable<std::unique_ptr<T, D>> : is_trivially_relocatable<D> {};
+
+#ifdef _LIBCPP_VERSION
+    // В libstdc++ строка с SSO хранит указатель на собственный буфер, поэтому включается только для libc++
+    template <typename C, typename Tr, typename A>
+    struct is_trivially_relocatable<std::basic_string<C, Tr, A>> : is_trivially_relocatable<A> {};
+#endif
+
+    template <typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    /// Аллокатор, умеющий изменять размер блока с побайтовым переносом содержимого (см. realloc_allocator)
+    template <typename A, typename T>
+    concept reallocating_allocator = requires(A a, T *p, std::size_t n){
+        { a.reallocate(p, n, n) } -> std::same_as<T *>;
+    };
+
+    /// Результат выделения памяти с фактической ёмкостью блока (аналог std::allocation_result из C++23)
+    /// \tparam Pointer Тип указателя
+    template <typename Pointer>
+    struct allocation_result {
+        Pointer ptr;
+        std::size_t count;
+    };
+
+    /// Аллокатор, сообщающий фактический размер выделенного блока через allocate_at_least/reallocate_at_least
+    template <typename A, typename T>
+    concept sized_allocator = requires(A a, T *p, std::size_t n){
+        { a.allocate_at_least(n) } -> std::same_as<allocation_result<T *>>;
+        { a.reallocate_at_least(p, n, n) } -> std::same_as<allocation_result<T *>>;
+    };
+
+    /// Тег конструктора из диапазона (аналог std::from_range_t из C++23)
+    struct from_range_t {
+        explicit from_range_t() = default;
+    };
+
+    inline constexpr from_range_t from_range{};
+
+    /// Параметры параллельного конструирования и копирования. Каждый поток конструирует свой кусок вектора
+    /// и первым касается его страниц, поэтому память распределяется между узлами NUMA
+    struct parallel_policy {
+        /// Количество потоков, 0 - std::thread::hardware_concurrency()
+        unsigned threads = 0;
+
+        /// Минимальное количество элементов на поток; меньшие векторы конструируются последовательно
+        std::size_t grain = std::size_t{1} << 16;
+    };
+
+    /// Тег параллельного конструирования с параметрами по умолчанию
+    inline constexpr parallel_policy parallel{};
+
+    /// Политика роста: по текущей ёмкости, требуемому количеству элементов и размеру элемента
+    /// возвращает новую ёмкость, не меньшую required
+    template <typename P>
+    concept growth_policy = requires(std::size_t n){
+        { P::next_capacity(n, n, n) } -> std::convertible_to<std::size_t>;
+    };
+
+    /// Рост в 2 раза
+    struct doubling_growth {
+        static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t) noexcept{
+            return std::max(capacity ? capacity * 2 : 1, required);
+        }
+    };
+
+    /// Рост в 1.5 раза: освобождённые при росте блоки со временем могут быть переиспользованы
+    struct half_growth {
+        static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t) noexcept{
+            return std::max(capacity + capacity / 2, std::max(required, std::size_t{1}));
+        }
+    };
+
+    /// Рост по политике Base с округлением блоков от страницы и больше до целого числа страниц
+    /// \tparam Base Исходная политика роста
+    /// \tparam Page Размер страницы в байтах
+    template <typename Base = doubling_growth, std::size_t Page = 4096>
+    struct page_growth {
+        static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                                   std::size_t elementSize) noexcept{
+            std::size_t next = Base::next_capacity(capacity, required, elementSize);
+            std::size_t bytes = next * elementSize;
+            if (bytes < Page){
+                return next;
+            }
+            return (bytes + Page - 1) / Page * Page / elementSize;
+        }
+    };
+
+    /// Рост по политике Base с округлением блока до размерного класса malloc, так что запас,
+    /// который malloc всё равно выделил бы, становится ёмкостью вектора.
+    /// Размерные классы соответствуют glibc (блоки кратны 16 байтам с 8 байтами заголовка,
+    /// блоки от 128 КБ отображаются целыми страницами); для аллокаторов с allocate_at_least
+    /// вектор дополнительно принимает фактический размер блока
+    /// \tparam Base Исходная политика роста
+    template <typename Base = doubling_growth>
+    struct size_class_growth {
+        static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                                   std::size_t elementSize) noexcept{
+            std::size_t next = Base::next_capacity(capacity, required, elementSize);
+            return std::max(next, malloc_size_class(next * elementSize) / elementSize);
+        }
+
+        /// Количество байт, которое malloc фактически отдаёт на запрос в bytes байт
+        /// \param bytes Запрошенный размер
+        /// \return Размер доступного блока
+        static constexpr std::size_t malloc_size_class(std::size_t bytes) noexcept{
+            constexpr std::size_t header = sizeof(std::size_t);
+            constexpr std::size_t alignment = 2 * sizeof(std::size_t);
+            constexpr std::size_t mmap_threshold = 128 * 1024;
+            constexpr std::size_t page = 4096;
+            if (bytes + header >= mmap_threshold){
+                return (bytes + 2 * header + page - 1) / page * page - 2 * header;
+            }
+            std::size_t chunk = std::max((bytes + header + alignment - 1) / alignment * alignment, 4 * header);
+            return chunk - header;
+        }
+    };
+
+    /// Политика учёта: статические функции, которые vector вызывает при выделении и освобождении блоков,
+    /// росте ёмкости, переносе элементов и разрушении
+    template <typename P>
+    concept telemetry_policy = requires(std::size_t n){
+        P::on_allocate(n, n);
+        P::on_deallocate(n);
+        P::on_reallocate(n, n);
+        P::on_relocate(n, n);
+        P::on_destroy(n, n, n);
+    };
+
+    /// Учёт отключён: пустые функции, вызовы которых удаляются компилятором.
+    /// Аргументы: on_allocate(ёмкость, байты), on_deallocate(байты), on_reallocate(прежняя ёмкость, новая ёмкость),
+    /// on_relocate(элементы, байты), on_destroy(размер, ёмкость, размер элемента)
+    struct no_telemetry {
+        static constexpr void on_allocate(std::size_t, std::size_t) noexcept{}
+        static constexpr void on_deallocate(std::size_t) noexcept{}
+        static constexpr void on_reallocate(std::size_t, std::size_t) noexcept{}
+        static constexpr void on_relocate(std::size_t, std::size_t) noexcept{}
+        static constexpr void on_destroy(std::size_t, std::size_t, std::size_t) noexcept{}
+    };
+
+    /// Вектор
+    /// \tparam T Тип хранимых значений
+    /// \tparam Allocator Аллокатор, через который выделяется память и конструируются элементы
+    /// \tparam GrowthPolicy Политика роста ёмкости при добавлении в заполненный вектор
+    /// \tparam Telemetry Политика учёта выделений памяти и роста (по умолчанию no_telemetry, без затрат)
+    template <typename T, typename Allocator = std::allocator<T>, growth_policy GrowthPolicy = doubling_growth,
+              telemetry_policy Telemetry = no_telemetry>
+    class vector {
+    public:
+        /// Тип итератора
+        using iterator = VectorIterator<T, false>;
+
+        /// Тип константного итератора
+        using const_iterator = VectorIterator<T, true>;
+
+        /// Тип хранимых значений
+        using value_type = T;
+
+        /// Тип аллокатора
+        using allocator_type = Allocator;
+
+        /// Политика роста
+        using growth_policy_type = GrowthPolicy;
+
+        /// Политика учёта выделений памяти
+        using telemetry_type = Telemetry;
+
+        /// Тип, обозначающий дистанцию между двумя итераторами, т.е. результат std::distance(it1, it2)
+        using difference_type = std::ptrdiff_t;
+
+        /// Тип указателя на хранимое значение, для const_iterator - const T*, для обычного - T*
+        using pointer = T *;
+
+        /// Ссылка на тип хранимых значений
+        using reference = T &;
+
+        /// Константная ссылка на тип хранимых значений
+        using const_reference = const T &;
+
+        /// Тип, используемый для преставления размера контейнера
+        using size_type = std::size_t;
+    protected:
+        using alloc_traits = std::allocator_traits<Allocator>;
+        static_assert(std::is_same_v<typename alloc_traits::value_type, T>,
+                      "Allocator::value_type must be the same as T");
+        static_assert(std::is_same_v<typename alloc_traits::pointer, T *>,
+                      "Allocator::pointer must be a raw pointer");
+
+        size_type _size = 0;
+        size_type _capacity = 0;
+        T *array = nullptr;
+        [[no_unique_address]] Allocator alloc{};
+        /// Элементы перемещаются memcpy/memmove. Для типов, принимающих аллокатор, перенос обязан идти через
+        /// alloc_traits::construct, поэтому для них используется поэлементное перемещение
+        static constexpr bool relocatable = is_trivially_relocatable_v<T> && !std::uses_allocator_v<T, Allocator>;
+
+        /// Рост блока на месте через Allocator::reallocate, без выделения второго буфера
+        static constexpr bool reallocatable = relocatable && reallocating_allocator<Allocator, T>;
+
+        constexpr void erase_till_end(iterator pos) noexcept;
+        constexpr void deallocate() noexcept;
+        constexpr T *allocate_block(size_type &n);
+        constexpr void release_block(T *block, size_type n) noexcept;
+        void reallocate_block(size_type n) requires reallocatable;
+        constexpr void grow_to(size_type required);
+        template <typename It>
+        constexpr It construct_n(T *dest, It first, size_type n);
+        template <typename It>
+        constexpr void assign_n(It first, size_type n);
+        constexpr bool contains(const T *p) const noexcept;
+        template <typename Construct>
+        constexpr void construct_each(size_type from, size_type to, Construct &&construct);
+        template <typename Chunk>
+        void parallel_construct(const parallel_policy &policy, size_type n, Chunk &&chunk);
+        template <typename Construct>
+        constexpr void insert_with(size_type index, size_type n, Construct &&construct);
+        template <typename It, typename S>
+        constexpr void insert_input(size_type index, It first, S last);
+        constexpr void relocate(T *from, size_type n, T *to) noexcept(relocatable || std::is_nothrow_move_constructible_v<T>);
+        template <typename ...Args>
+        constexpr void grow_and_emplace(Args &&... args);
+
+        /// Конструктор, принимающий уже выделенный аллокатором пустой блок памяти (используется small_vector)
+        /// \param storage Блок памяти
+        /// \param capacity Ёмкость блока
+        /// \param allocator Аллокатор, которым будет освобождён блок
+        constexpr vector(T *storage, size_type capacity, const Allocator &allocator) noexcept
+                : _capacity{capacity}, array{storage}, alloc{allocator}{}
+    public:
+        /// Пустой конструктор, создаёт пустой вектор
+        constexpr vector() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+        /// Конструктор пустого вектора с заданным аллокатором
+        /// \param allocator Аллокатор
+        constexpr explicit vector(const Allocator &allocator) noexcept: alloc{allocator}{}
+
+        /// Конструктор, заполняющий вектор n копиями T()
+        /// \param capacity Количество элементов
+        /// \param allocator Аллокатор
+        constexpr explicit vector(size_type capacity, const Allocator &allocator = Allocator())
+        requires std::copy_constructible<T>;
+
+        /// Конструктор, заполняющий вектор n копиями el
+        /// \param size Количество элементов
+        /// \param el Значение элемента, которым будет заполнен вектор
+        /// \param allocator Аллокатор
+        constexpr explicit vector(size_type size, const T &el, const Allocator &allocator = Allocator())
+        requires std::copy_constructible<T>;
+
+        /// Конструктор, заполняющий вектор элементами из списка инициализации
+        /// \param list inisializer_list, из которого будут скопированы значения
+        /// \param allocator Аллокатор
+        constexpr vector(std::initializer_list<T> list, const Allocator &allocator = Allocator())
+        requires std::move_constructible<T>;
+
+        /// Копирующий конструктор, аллокатор получается через select_on_container_copy_construction
+        /// \param second Другой вектор
+        constexpr vector(const vector &second) requires std::copy_constructible<T>;
+
+        /// Копирующий конструктор с заданным аллокатором
+        /// \param second Другой вектор
+        /// \param allocator Аллокатор
+        constexpr vector(const vector &second, const Allocator &allocator) requires std::copy_constructible<T>;
+
+        /// Перемещающий конструктор
+        /// \param second Другой вектор
+        constexpr vector(vector &&second) noexcept;
+
+        /// Перемещающий конструктор с заданным аллокатором.
+        /// Если аллокаторы не равны, элементы перемещаются поштучно
+        /// \param second Другой вектор
+        /// \param allocator Аллокатор
+        constexpr vector(vector &&second, const Allocator &allocator) requires std::move_constructible<T>;
+
+        /// Конструктор, заполняющий вектор элементами диапазона [first, last).
+        /// Для forward-итераторов память выделяется один раз
+        /// \param first Итератор на начало диапазона
+        /// \param last Конец диапазона
+        /// \param allocator Аллокатор
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires std::constructible_from<T, std::iter_reference_t<It>>
+        constexpr vector(It first, S last, const Allocator &allocator = Allocator());
+
+        /// Конструктор, заполняющий вектор элементами диапазона
+        /// \param range Диапазон
+        /// \param allocator Аллокатор
+        template <std::ranges::input_range R>
+        requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+        constexpr vector(from_range_t, R &&range, const Allocator &allocator = Allocator());
+
+        /// Параллельный конструктор, заполняющий вектор n копиями T()
+        /// \param policy Параметры параллельного конструирования
+        /// \param size Количество элементов
+        /// \param allocator Аллокатор
+        vector(const parallel_policy &policy, size_type size, const Allocator &allocator = Allocator())
+        requires std::default_initializable<T>;
+
+        /// Параллельный конструктор, заполняющий вектор n копиями el
+        /// \param policy Параметры параллельного конструирования
+        /// \param size Количество элементов
+        /// \param el Значение элемента, которым будет заполнен вектор
+        /// \param allocator Аллокатор
+        vector(const parallel_policy &policy, size_type size, const T &el, const Allocator &allocator = Allocator())
+        requires std::copy_constructible<T>;
+
+        /// Параллельный копирующий конструктор
+        /// \param policy Параметры параллельного конструирования
+        /// \param second Другой вектор
+        vector(const parallel_policy &policy, const vector &second) requires std::copy_constructible<T>;
+
+        /// Оператор присваивания копированием для вектора
+        /// \param second Другой вектор
+        /// \return Ссылка на текущий вектор после присваивания
+        constexpr vector &operator=(const vector &second) requires std::copy_constructible<T>;
+
+        /// Оператор присваивания перемещением для вектора
+        /// \param second Другой вектор
+        /// \return Ссылка на текущий вектор после присваивания
+        constexpr vector &operator=(vector &&second) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                    alloc_traits::is_always_equal::value);
+
+        /// Оператор присваивания из списка инициализации для вектора
+        /// \param list inisializer_list, из которого будут скопированы значения
+        /// \return Ссылка на текущий вектор после присваивания
+        constexpr vector &operator=(std::initializer_list<T> list) requires std::copy_constructible<T>;
+
+        /// Заменяет содержимое вектора n копиями value. Живые элементы переприсваиваются, недостающие
+        /// конструируются, лишние уничтожаются; память перевыделяется только если n больше ёмкости
+        /// \param n Количество элементов
+        /// \param value Значение (может быть элементом самого вектора)
+        constexpr void assign(size_type n, const T &value) requires std::copy_constructible<T>;
+
+        /// Заменяет содержимое вектора элементами диапазона [first, last), переиспользуя живые элементы
+        /// и память так же, как assign(n, value)
+        /// \param first Итератор на начало диапазона (не должен указывать внутрь вектора)
+        /// \param last Конец диапазона
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires std::constructible_from<T, std::iter_reference_t<It>>
+        constexpr void assign(It first, S last);
+
+        /// Параллельное присваивание копированием. Если ёмкости не хватает, старый блок освобождается
+        /// до выделения нового, и страницы нового блока первыми касаются рабочие потоки
+        /// \param policy Параметры параллельного конструирования
+        /// \param second Другой вектор
+        void assign(const parallel_policy &policy, const vector &second) requires std::copy_constructible<T>;
+
+        /// Оператор доступа к элементу вектора по индексу
+        /// \param index Индекс элемента
+        /// \return Ссылка на элемент вектора по указанному индексу
+        [[nodiscard]] constexpr T &operator[](size_type index){ return array[index]; };
+
+        /// Оператор доступа к элементу вектора по индексу (константная версия)
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент вектора по указанному индексу
+        [[nodiscard]] constexpr const T &operator[](size_type index) const{ return array[index]; };
+
+        /// Возвращает размер вектора (количество элементов)
+        /// \return Размер вектора
+        [[nodiscard]] constexpr size_type size() const noexcept{ return _size; };
+
+        /// Возвращает текущую ёмкость вектора
+        /// \return Текущая ёмкость вектора
+        [[nodiscard]] constexpr size_type capacity() const noexcept{ return _capacity; };
+
+        /// Проверяет, является ли вектор пустым
+        /// \return true, если вектор пуст, иначе false
+        [[nodiscard]] constexpr bool empty() const noexcept{ return _size == 0; };
+
+        /// Увеличивает ёмкость вектора до указанной величины
+        /// \param newCap Новая ёмкость вектора
+        constexpr void reserve(size_type newCap);
+
+        /// Увеличивает ёмкость, как reserve(), и сразу касается каждой страницы свободной части блока,
+        /// чтобы последующие добавления не вызывали page fault
+        /// \param newCap Новая ёмкость вектора
+        void reserve_prefaulted(size_type newCap);
+
+        /// Закрепляет страницы текущего блока в памяти (mlock). Закрепление относится к блоку:
+        /// при росте вектора новый блок нужно закрепить заново, а старый остаётся закреплённым до unlock_pages()
+        /// или возврата памяти системе, поэтому ёмкость стоит зарезервировать заранее
+        void lock_pages();
+
+        /// Снимает закрепление страниц текущего блока (munlock)
+        void unlock_pages() noexcept;
+
+        /// Изменяет размер вектора: лишние элементы разрушаются, новые инициализируются значением T()
+        /// \param newSize Новый размер
+        constexpr void resize(size_type newSize) requires std::default_initializable<T>;
+
+        /// Изменяет размер вектора: лишние элементы разрушаются, новые копируются из value
+        /// \param newSize Новый размер
+        /// \param value Значение новых элементов
+        constexpr void resize(size_type newSize, const T &value) requires std::copy_constructible<T>;
+
+        /// Изменяет размер вектора, инициализируя новые элементы по умолчанию (default-init):
+        /// для тривиальных типов память не заполняется, значения должны быть перезаписаны
+        /// \param newSize Новый размер
+        void resize_for_overwrite(size_type newSize) requires std::default_initializable<T>;
+
+        /// Возвращает окно из n неинициализированных ячеек после последнего элемента, например для read()/recv().
+        /// Размер вектора не меняется до вызова commit_append(); любое другое изменение вектора делает окно недействительным
+        /// \param n Размер окна
+        /// \return Окно для записи
+        [[nodiscard]] std::span<T> append_window(size_type n)
+        requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>;
+
+        /// Добавляет в вектор первые written элементов окна, полученного от append_window()
+        /// \param written Количество записанных элементов (не больше размера окна)
+        void commit_append(size_type written) noexcept
+        requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>{
+            _size += written;
+        }
+
+        /// Возвращает константную ссылку на элемент вектора по указанному индексу с проверкой границ
+        /// \param index Индекс элемента
+        /// \return Константная ссылка на элемент вектора по указанному индексу
+        [[nodiscard]] constexpr const T &at(size_type index) const;
+
+        /// Возвращает ссылку на элемент вектора по указанному индексу с проверкой границ
+        /// \param index Индекс элемента
+        /// \return Ссылка на элемент вектора по указанному индексу
+        [[nodiscard]] constexpr T &at(size_type index);
+
+        /// Возвращает константную ссылку на первый элемент вектора
+        /// \return Константная ссылка на первый элемент вектора
+        [[nodiscard]] constexpr const T &front() const{ return array[0]; };
+
+        /// Возвращает ссылку на первый элемент вектора
+        /// \return Ссылка на первый элемент вектора
+        [[nodiscard]] constexpr T &front(){ return array[0]; };
+
+        /// Возвращает константную ссылку на последний элемент вектора
+        /// \return Константная ссылка на последний элемент вектора
+        [[nodiscard]] constexpr const T &back() const{ return array[_size - 1]; };
+
+        /// Возвращает ссылку на последний элемент вектора
+        /// \return Ссылка на последний элемент вектора
+        [[nodiscard]] constexpr T &back(){ return array[_size - 1]; };
+
+        /// Возвращает указатель на начало массива вектора
+        /// \return Указатель на начало массива вектора
+        [[nodiscard]] constexpr const T *data() const{ return array; };
+
+        /// Возвращает указатель на начало массива вектора (константная версия)
+        /// \return Указатель на начало массива вектора
+        [[nodiscard]] constexpr T *data(){ return array; };
+
+        /// Копирует элемент в конец вектора
+        /// \param element Добавляемый элемент
+        constexpr void push_back(const T &element) requires std::copy_constructible<T>;
+
+        /// Перемещает элемент в конец вектора
+        /// \param element Добавляемый элемент
+        constexpr void push_back(T &&element) requires std::move_constructible<T>;
+
+        /// Создает и добавляет элемент в конец вектора
+        /// \tparam Args Типы аргументов для конструирования элемента
+        /// \param args Аргументы для конструирования элемента
+        template <typename ...Args>
+        constexpr void emplace_back(Args &&... args) requires std::constructible_from<T, Args...>;
+
+        /// Очищает вектор, вызывая деструктор хранимых объектов и устанавливая размер в 0
+        constexpr void clear() noexcept;
+
+        /// Деструктор
+        constexpr ~vector();
+
+        /// Получение итератора на начало списка
+        /// \return Итератор, адресующий начало списка
+        constexpr iterator begin() noexcept{ return iterator(array); }
+
+        /// Получение итератора на конец списка
+        /// \return Итератор, адресующий конец списка
+        constexpr iterator end() noexcept{ return iterator(array + _size); }
+
+        /// Получение константного итератора на начало списка
+        /// \return Итератор, адресующий начало списка
+        constexpr const_iterator begin() const noexcept{ return const_iterator(array); }
+
+        /// Получение константного итератора на конец списка
+        /// \return Итератор, адресующий конец списка
+        constexpr const_iterator end() const noexcept{ return const_iterator(array + _size); }
+
+        /// Получение константного итератора на начало списка
+        /// \return Итератор, адресующий начало списка
+        constexpr const_iterator cbegin() const noexcept{ return const_iterator(array); }
+
+        /// Получение константного итератора на конец списка
+        /// \return Итератор, адресующий конец списка
+        constexpr const_iterator cend() const noexcept{ return const_iterator(array + _size); }
+
+        /// Удаляет элемент из вектора по указанному итератору
+        /// \param it Итератор на удаляемый элемент
+        /// \return Итератор на элемент, следующий за удаленным элементом
+        constexpr iterator erase(iterator it) noexcept;
+
+        /// Удаляет элементы в диапазоне [first, last) из вектора
+        /// \param first Итератор на начало диапазона
+        /// \param last Итератор на конец диапазона (не включая)
+        /// \return Итератор на элемент, следующий за последним удаленным элементом
+        constexpr iterator erase(iterator first, iterator last) noexcept;
+
+        /// Удаляет элемент, перемещая на его место последний; порядок элементов не сохраняется
+        /// \param it Итератор на удаляемый элемент
+        /// \return Итератор на элемент, занявший место удаленного
+        constexpr iterator unordered_erase(iterator it) noexcept;
+
+        /// Извлекает элемент по индексу, перемещая на его место последний; порядок элементов не сохраняется
+        /// \param index Индекс элемента
+        /// \return Извлечённый элемент
+        constexpr T swap_remove(size_type index) requires std::move_constructible<T>;
+
+        /// Оставляет только элементы, для которых pred вернул true, за один проход; хвост уничтожается один раз.
+        /// Предикат получает изменяемую ссылку и может обновить оставляемый элемент
+        /// \param pred Предикат, вызываемый с T&
+        /// \return Количество удалённых элементов
+        template <typename Pred>
+        requires std::predicate<Pred &, T &>
+        constexpr size_type retain(Pred pred);
+
+        /// Вставляет копию value перед pos
+        /// \param pos Итератор, перед которым вставляется элемент
+        /// \param value Значение (может быть элементом самого вектора)
+        /// \return Итератор на вставленный элемент
+        constexpr iterator insert(iterator pos, const T &value) requires std::copy_constructible<T>;
+
+        /// Вставляет value перемещением перед pos
+        /// \param pos Итератор, перед которым вставляется элемент
+        /// \param value Значение (не должно быть элементом самого вектора)
+        /// \return Итератор на вставленный элемент
+        constexpr iterator insert(iterator pos, T &&value) requires std::move_constructible<T>;
+
+        /// Конструирует элемент перед pos. При перевыделении элемент конструируется сразу в новом блоке,
+        /// иначе хвост сдвигается (memmove для тривиально перемещаемых типов)
+        /// \tparam Args Типы аргументов для конструирования элемента
+        /// \param pos Итератор, перед которым вставляется элемент
+        /// \param args Аргументы для конструирования элемента
+        /// \return Итератор на вставленный элемент
+        template <typename ...Args>
+        requires std::constructible_from<T, Args...> && std::move_constructible<T>
+        constexpr iterator emplace(iterator pos, Args &&... args);
+
+        /// Вставляет элементы диапазона [first, last) перед pos. Для forward-итераторов и диапазонов
+        /// с известным размером память перевыделяется не более одного раза, элементы конструируются на месте
+        /// \param pos Итератор, перед которым вставляются элементы
+        /// \param first Итератор на начало диапазона (не должен указывать внутрь вектора)
+        /// \param last Конец диапазона
+        /// \return Итератор на первый вставленный элемент
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires std::constructible_from<T, std::iter_reference_t<It>>
+        constexpr iterator insert(iterator pos, It first, S last);
+
+        /// Вставляет n копий value перед pos
+        /// \param pos Итератор, перед которым вставляются элементы
+        /// \param n Количество элементов
+        /// \param value Значение (может быть элементом самого вектора)
+        /// \return Итератор на первый вставленный элемент
+        constexpr iterator insert(iterator pos, size_type n, const T &value) requires std::copy_constructible<T>;
+
+        /// Вставляет элементы диапазона перед pos
+        /// \param pos Итератор, перед которым вставляются элементы
+        /// \param range Диапазон
+        /// \return Итератор на первый вставленный элемент
+        template <std::ranges::input_range R>
+        requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+        constexpr iterator insert_range(iterator pos, R &&range);
+
+        /// Добавляет элементы диапазона в конец вектора
+        /// \param range Диапазон
+        template <std::ranges::input_range R>
+        requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+        constexpr void append_range(R &&range);
+
+        /// Заменяет содержимое вектора элементами диапазона
+        /// \param range Диапазон
+        template <std::ranges::input_range R>
+        requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+        constexpr void assign_range(R &&range);
+
+        /// Обменивает содержимое двух векторов.
+        /// Аллокаторы обмениваются только при propagate_on_container_swap
+        /// \param second Другой вектор
+        constexpr void swap(vector &second) noexcept;
+
+        /// Возвращает копию аллокатора вектора
+        /// \return Аллокатор
+        [[nodiscard]] constexpr allocator_type get_allocator() const noexcept{ return alloc; }
+    };
+
+    /// Удаляет из вектора элементы, для которых pred вернул true, за один проход
+    /// \param v Вектор
+    /// \param pred Предикат
+    /// \return Количество удалённых элементов
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry, typename Pred>
+    constexpr std::size_t erase_if(vector<T, Allocator, GrowthPolicy, Telemetry> &v, Pred pred){
+        return v.retain([&pred](T &element){ return !static_cast<bool>(pred(element)); });
+    }
+
+    /// Удаляет из вектора элементы, равные value, за один проход
+    /// \param v Вектор
+    /// \param value Значение (не должно быть элементом самого вектора)
+    /// \return Количество удалённых элементов
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry, typename U>
+    constexpr std::size_t erase(vector<T, Allocator, GrowthPolicy, Telemetry> &v, const U &value){
+        return v.retain([&value](T &element){ return !(element == value); });
+    }
+
+    template <typename T, typename GrowthPolicy, typename Telemetry>
+    struct is_trivially_relocatable<vector<T, std::allocator<T>, GrowthPolicy, Telemetry>> : std::true_type {};
+
+    namespace pmr {
+        /// Вектор, использующий std::pmr::memory_resource для выделения памяти
+        /// \tparam T Тип хранимых значений
+        template <typename T, typename GrowthPolicy = doubling_growth, typename Telemetry = no_telemetry>
+        using vector = MyVec::vector<T, std::pmr::polymorphic_allocator<T>, GrowthPolicy, Telemetry>;
+    }
+}
+
+namespace MyVec {
+    template <typename T>
+    using iterator = VectorIterator<T, false>;
+    template <typename T>
+    using const_iterator = VectorIterator<T, true>;
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry>::vector(size_type capacity, const Allocator &allocator) requires std::copy_constructible<T>
+            : alloc{allocator}{
+        reserve(capacity);
+        for (size_type i = 0; i < capacity; i++){
+            alloc_traits::construct(alloc, &array[i]);
+            _size++;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry>::vector(size_type size, const T &el, const Allocator &allocator)
+    requires std::copy_constructible<T>: alloc{allocator}{
+        reserve(size);
+        for (size_type i = 0; i < size; i++){
+            alloc_traits::construct(alloc, &array[i], el);
+            _size++;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry>::vector(std::initializer_list<T> list, const Allocator &allocator)
+    requires std::move_constructible<T>: alloc{allocator}{
+        reserve(list.size());
+        for (const T &element: list){
+            alloc_traits::construct(alloc, &array[_size], element);
+            _size++;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry>::vector(const vector &second) requires std::copy_constructible<T>
+            : alloc{alloc_traits::select_on_container_copy_construction(second.alloc)}{
+        reserve(second.size());
+        for (size_type i = 0; i < second._size; i++){
+            alloc_traits::construct(alloc, &array[i], second.array[i]);
+            _size++;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry>::vector(const vector &second, const Allocator &allocator) requires std::copy_constructible<T>
+            : alloc{allocator}{
+        reserve(second.size());
+        for (size_type i = 0; i < second._size; i++){
+            alloc_traits::construct(alloc, &array[i], second.array[i]);
+            _size++;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry>::vector(vector &&second) noexcept
+            : _size{second._size}, _capacity{second._capacity}, array{second.array}, alloc{std::move(second.alloc)}{
+        second._size = 0;
+        second._capacity = 0;
+        second.array = nullptr;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry>::vector(vector &&second, const Allocator &allocator) requires std::move_constructible<T>
+            : alloc{allocator}{
+        if (alloc == second.alloc){
+            std::swap(array, second.array);
+            std::swap(_size, second._size);
+            std::swap(_capacity, second._capacity);
+            return;
+        }
+        reserve(second.size());
+        for (size_type i = 0; i < second._size; i++){
+            alloc_traits::construct(alloc, &array[i], std::move(second.array[i]));
+            _size++;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry> &vector<T, Allocator, GrowthPolicy, Telemetry>::operator=(const vector &second) requires std::copy_constructible<T>{
+        if (this != &second){
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value){
+                if (alloc != second.alloc){
+                    // Память текущего аллокатора не может быть освобождена новым
+                    clear();
+                    deallocate();
+                }
+                alloc = second.alloc;
+            }
+            assign_n(second.array, second._size);
+        }
+        return *this;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry> &vector<T, Allocator, GrowthPolicy, Telemetry>::operator=(vector &&second)
+    noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value){
+        if (this == &second){
+            return *this;
+        }
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value){
+            clear();
+            deallocate();
+            alloc = std::move(second.alloc);
+        } else if (alloc != second.alloc){
+            clear();
+            reserve(second._size);
+            for (size_type i = 0; i < second._size; i++){
+                alloc_traits::construct(alloc, &array[i], std::move(second.array[i]));
+                _size++;
+            }
+            second.clear();
+            return *this;
+        }
+        std::swap(array, second.array);
+        std::swap(_size, second._size);
+        std::swap(_capacity, second._capacity);
+        return *this;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry> &vector<T, Allocator, GrowthPolicy, Telemetry>::operator=(std::initializer_list<T> list)
+    requires std::copy_constructible<T>{
+        assign_n(list.begin(), list.size());
+        return *this;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::assign(size_type n, const T &value) requires std::copy_constructible<T>{
+        if (contains(std::addressof(value))){
+            // Элемент может быть уничтожен или перезаписан раньше, чем скопирован во все позиции
+            T copy(value);
+            assign(n, copy);
+            return;
+        }
+        if (n > _capacity){
+            clear();
+            deallocate();
+            reserve(n);
+        }
+        size_type live = std::min(n, _size);
+        std::fill_n(array, live, value);
+        if (n > live){
+            construct_each(live, n, [this, &value](T *slot){ alloc_traits::construct(alloc, slot, value); });
+            _size = n;
+        } else {
+            erase_till_end(begin() + n);
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    requires std::constructible_from<T, std::iter_reference_t<It>>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::assign(It first, S last){
+        if constexpr (std::forward_iterator<It>){
+            size_type n = std::ranges::distance(first, last);
+            assign_n(std::move(first), n);
+        } else {
+            size_type i = 0;
+            if constexpr (std::assignable_from<T &, std::iter_reference_t<It>>){
+                for (; i < _size && first != last; ++i, ++first){
+                    array[i] = *first;
+                }
+            }
+            erase_till_end(begin() + i);
+            insert(end(), std::move(first), std::move(last));
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <typename It>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::assign_n(It first, size_type n){
+        if (n > _capacity){
+            // Переприсваивать нечего: старый блок освобождается до выделения нового
+            clear();
+            deallocate();
+            reserve(n);
+            construct_n(array, std::move(first), n);
+            _size = n;
+            return;
+        }
+        size_type live = std::min(n, _size);
+        if constexpr (std::assignable_from<T &, std::iter_reference_t<It>>){
+            if constexpr (std::contiguous_iterator<It>){
+                std::copy_n(std::to_address(first), live, array);
+                first += live;
+            } else {
+                for (size_type i = 0; i < live; ++i, ++first){
+                    array[i] = *first;
+                }
+            }
+        } else {
+            clear();
+            live = 0;
+        }
+        if (n > live){
+            construct_n(array + live, std::move(first), n - live);
+            _size = n;
+        } else {
+            erase_till_end(begin() + n);
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr bool vector<T, Allocator, GrowthPolicy, Telemetry>::contains(const T *p) const noexcept{
+        if (std::is_constant_evaluated()){
+            // При вычислении на этапе компиляции указатели на разные объекты сравниваются только на равенство
+            for (size_type i = 0; i < _size; i++){
+                if (p == array + i){
+                    return true;
+                }
+            }
+            return false;
+        }
+        return !std::less<const T *>()(p, array) && std::less<const T *>()(p, array + _size);
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::reserve(size_type newCap){
+        if (newCap <= _capacity){
+            return;
+        }
+
+        if constexpr (reallocatable){
+            if (!std::is_constant_evaluated()){
+                reallocate_block(newCap);
+                return;
+            }
+        }
+
+        T *buffer = allocate_block(newCap);
+        try {
+            relocate(array, _size, buffer);
+        } catch (...){
+            release_block(buffer, newCap);
+            throw;
+        }
+        if (array){
+            Telemetry::on_reallocate(_capacity, newCap);
+        }
+        size_type temp = _size;
+        _size = 0;
+        deallocate();
+        array = buffer;
+        _capacity = newCap;
+        _size = temp;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    void vector<T, Allocator, GrowthPolicy, Telemetry>::reserve_prefaulted(size_type newCap){
+        reserve(newCap);
+        constexpr std::size_t page = 4096;
+        auto *first = reinterpret_cast<volatile unsigned char *>(array + _size);
+        auto *last = reinterpret_cast<volatile unsigned char *>(array + _capacity);
+        // Память свободной части не содержит объектов, запись байта только отображает страницу
+        for (volatile unsigned char *p = first; p < last; p += page){
+            *p = 0;
+        }
+        if (first < last){
+            *(last - 1) = 0;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    void vector<T, Allocator, GrowthPolicy, Telemetry>::lock_pages(){
+        if (array && ::mlock(array, _capacity * sizeof(T)) != 0){
+            throw std::system_error(errno, std::generic_category(), "mlock failed");
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    void vector<T, Allocator, GrowthPolicy, Telemetry>::unlock_pages() noexcept{
+        if (array){
+            ::munlock(array, _capacity * sizeof(T));
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr T *vector<T, Allocator, GrowthPolicy, Telemetry>::allocate_block(size_type &n){
+        if constexpr (sized_allocator<Allocator, T>){
+            allocation_result<T *> result = alloc.allocate_at_least(n);
+            n = result.count;
+            Telemetry::on_allocate(n, n * sizeof(T));
+            return result.ptr;
+        } else {
+            T *block = alloc_traits::allocate(alloc, n);
+            Telemetry::on_allocate(n, n * sizeof(T));
+            return block;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::release_block(T *block, size_type n) noexcept{
+        Telemetry::on_deallocate(n * sizeof(T));
+        alloc_traits::deallocate(alloc, block, n);
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    void vector<T, Allocator, GrowthPolicy, Telemetry>::reallocate_block(size_type n) requires reallocatable{
+        if (!array){
+            array = allocate_block(n);
+        } else {
+            if constexpr (sized_allocator<Allocator, T>){
+                allocation_result<T *> result = alloc.reallocate_at_least(array, _capacity, n);
+                array = result.ptr;
+                n = result.count;
+            } else {
+                array = alloc.reallocate(array, _capacity, n);
+            }
+            Telemetry::on_deallocate(_capacity * sizeof(T));
+            Telemetry::on_allocate(n, n * sizeof(T));
+            Telemetry::on_reallocate(_capacity, n);
+        }
+        _capacity = n;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::relocate(T *from, size_type n, T *to)
+    noexcept(relocatable || std::is_nothrow_move_constructible_v<T>){
+        Telemetry::on_relocate(n, n * sizeof(T));
+        if constexpr (relocatable){
+            // memcpy недоступен при вычислении на этапе компиляции, там элементы переносятся поштучно
+            if (!std::is_constant_evaluated()){
+                if (n){
+                    std::memcpy(static_cast<void *>(to), static_cast<const void *>(from), n * sizeof(T));
+                }
+                return;
+            }
+        }
+        if constexpr (std::is_nothrow_move_constructible_v<T>){
+            for (size_type i = 0; i < n; i++){
+                alloc_traits::construct(alloc, &to[i], std::move(from[i]));
+                alloc_traits::destroy(alloc, &from[i]);
+            }
+        } else {
+            size_type i = 0;
+            try {
+                for (; i < n; i++){
+                    alloc_traits::construct(alloc, &to[i], std::move_if_noexcept(from[i]));
+                }
+            } catch (...){
+                for (size_type j = 0; j < i; j++){
+                    alloc_traits::destroy(alloc, &to[j]);
+                }
+                throw;
+            }
+            for (i = 0; i < n; i++){
+                alloc_traits::destroy(alloc, &from[i]);
+            }
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <typename ...Args>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::grow_and_emplace(Args &&... args){
+        size_type newCap = GrowthPolicy::next_capacity(_capacity, _size + 1, sizeof(T));
+
+        if constexpr (reallocatable){
+            if (!std::is_constant_evaluated()){
+                // Аргументы могут ссылаться на элементы вектора, поэтому элемент собирается во временном буфере
+                // и после роста переносится в хвост побайтово
+                alignas(T) std::byte tmp[sizeof(T)];
+                T *element = reinterpret_cast<T *>(tmp);
+                alloc_traits::construct(alloc, element, std::forward<Args>(args)...);
+                try {
+                    reserve(newCap);
+                } catch (...){
+                    alloc_traits::destroy(alloc, element);
+                    throw;
+                }
+                std::memcpy(static_cast<void *>(&array[_size]), static_cast<const void *>(element), sizeof(T));
+                _size++;
+                return;
+            }
+        }
+
+        T *buffer = allocate_block(newCap);
+        // Новый элемент конструируется до переноса старых: аргументы могут ссылаться на элементы самого вектора
+        try {
+            alloc_traits::construct(alloc, &buffer[_size], std::forward<Args>(args)...);
+        } catch (...){
+            release_block(buffer, newCap);
+            throw;
+        }
+        try {
+            relocate(array, _size, buffer);
+        } catch (...){
+            alloc_traits::destroy(alloc, &buffer[_size]);
+            release_block(buffer, newCap);
+            throw;
+        }
+        if (array){
+            Telemetry::on_reallocate(_capacity, newCap);
+        }
+        size_type temp = _size;
+        _size = 0;
+        deallocate();
+        array = buffer;
+        _capacity = newCap;
+        _size = temp + 1;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::grow_to(size_type required){
+        if (required > _capacity){
+            reserve(GrowthPolicy::next_capacity(_capacity, required, sizeof(T)));
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::resize(size_type newSize) requires std::default_initializable<T>{
+        if (newSize <= _size){
+            erase_till_end(begin() + newSize);
+            return;
+        }
+        grow_to(newSize);
+        for (; _size < newSize; _size++){
+            alloc_traits::construct(alloc, &array[_size]);
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::resize(size_type newSize, const T &value) requires std::copy_constructible<T>{
+        if (newSize <= _size){
+            erase_till_end(begin() + newSize);
+            return;
+        }
+        if (newSize > _capacity){
+            // value может быть элементом вектора
+            insert(end(), newSize - _size, value);
+            return;
+        }
+        for (; _size < newSize; _size++){
+            alloc_traits::construct(alloc, &array[_size], value);
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    void vector<T, Allocator, GrowthPolicy, Telemetry>::resize_for_overwrite(size_type newSize)
+    requires std::default_initializable<T>{
+        if (newSize <= _size){
+            erase_till_end(begin() + newSize);
+            return;
+        }
+        grow_to(newSize);
+        if constexpr (std::is_trivially_default_constructible_v<T>){
+            _size = newSize;
+        } else if constexpr (std::uses_allocator_v<T, Allocator>){
+            for (; _size < newSize; _size++){
+                alloc_traits::construct(alloc, &array[_size]);
+            }
+        } else {
+            for (; _size < newSize; _size++){
+                ::new(static_cast<void *>(&array[_size])) T;
+            }
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    std::span<T> vector<T, Allocator, GrowthPolicy, Telemetry>::append_window(size_type n)
+    requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>{
+        grow_to(_size + n);
+        return {array + _size, n};
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr const T &vector<T, Allocator, GrowthPolicy, Telemetry>::at(size_type index) const{
+        if (index >= _size){
+            throw std::out_of_range("Index is out of range");
+        }
+        return array[index];
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr T &vector<T, Allocator, GrowthPolicy, Telemetry>::at(size_type index){
+        if (index >= _size){
+            throw std::out_of_range("Index is out of range");
+        }
+        return array[index];
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::push_back(const T &element) requires std::copy_constructible<T>{
+        if (_size == _capacity){
+            grow_and_emplace(element);
+            return;
+        }
+        alloc_traits::construct(alloc, &array[_size], element);
+        _size++;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::push_back(T &&element) requires std::move_constructible<T>{
+        if (_size == _capacity){
+            grow_and_emplace(std::move(element));
+            return;
+        }
+        alloc_traits::construct(alloc, &array[_size], std::move(element));
+        _size++;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <typename ...Args>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::emplace_back(Args &&... args) requires std::constructible_from<T, Args...>{
+        if (_size == _capacity){
+            grow_and_emplace(std::forward<Args>(args)...);
+            return;
+        }
+        alloc_traits::construct(alloc, &array[_size], std::forward<Args>(args)...);
+        _size++;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::clear() noexcept{
+        for (size_type i = 0; i < _size; ++i){
+            alloc_traits::destroy(alloc, &array[i]);
+        }
+        _size = 0;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::deallocate() noexcept{
+        if (array){
+            release_block(array, _capacity);
+        }
+        array = nullptr;
+        _capacity = 0;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry>::~vector(){
+        Telemetry::on_destroy(_size, _capacity, sizeof(T));
+        clear();
+        deallocate();
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr iterator<T> vector<T, Allocator, GrowthPolicy, Telemetry>::erase(iterator it) noexcept{
+        if (it >= end()){
+            return end();
+        }
+
+        if constexpr (relocatable){
+            if (!std::is_constant_evaluated()){
+                alloc_traits::destroy(alloc, &*it);
+                std::memmove(static_cast<void *>(&*it), static_cast<const void *>(&*it + 1),
+                             (end() - it - 1) * sizeof(T));
+                --_size;
+                return it;
+            }
+        }
+
+        if (it + 1 != end()){
+            std::move(it + 1, end(), it);
+        }
+
+        alloc_traits::destroy(alloc, &array[--_size]);
+        return it;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr iterator<T> vector<T, Allocator, GrowthPolicy, Telemetry>::erase(iterator first, iterator last) noexcept{
+        if (first == last){
+            return first;
+        }
+
+        if constexpr (relocatable){
+            if (!std::is_constant_evaluated()){
+                for (iterator it = first; it != last; ++it){
+                    alloc_traits::destroy(alloc, &*it);
+                }
+                std::memmove(static_cast<void *>(&*first), static_cast<const void *>(&*last),
+                             (end() - last) * sizeof(T));
+                _size -= last - first;
+                return first;
+            }
+        }
+
+        if (last != end()){
+            std::move(last, end(), first);
+        }
+        erase_till_end(first + (end() - last));
+        return first;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr iterator<T> vector<T, Allocator, GrowthPolicy, Telemetry>::unordered_erase(iterator it) noexcept{
+        if (it >= end()){
+            return end();
+        }
+
+        T *last = array + _size - 1;
+        if constexpr (relocatable){
+            if (!std::is_constant_evaluated()){
+                alloc_traits::destroy(alloc, &*it);
+                if (&*it != last){
+                    std::memcpy(static_cast<void *>(&*it), static_cast<const void *>(last), sizeof(T));
+                }
+                --_size;
+                return it;
+            }
+        }
+
+        if (&*it != last){
+            *it = std::move(*last);
+        }
+        alloc_traits::destroy(alloc, last);
+        --_size;
+        return it;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr T vector<T, Allocator, GrowthPolicy, Telemetry>::swap_remove(size_type index) requires std::move_constructible<T>{
+        if (index >= _size){
+            throw std::out_of_range("Index out of range");
+        }
+        T removed = std::move(array[index]);
+        unordered_erase(begin() + index);
+        return removed;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <typename Pred>
+    requires std::predicate<Pred &, T &>
+    constexpr std::size_t vector<T, Allocator, GrowthPolicy, Telemetry>::retain(Pred pred){
+        size_type kept = 0;
+        size_type i = 0;
+        if constexpr (relocatable){
+            if (!std::is_constant_evaluated()){
+                // Удаляемые элементы уничтожаются сразу, оставляемые побайтово сдвигаются в образовавшиеся дыры
+                try {
+                    for (; i < _size; i++){
+                        if (pred(array[i])){
+                            if (kept != i){
+                                std::memcpy(static_cast<void *>(array + kept), static_cast<const void *>(array + i),
+                                            sizeof(T));
+                            }
+                            kept++;
+                        } else {
+                            alloc_traits::destroy(alloc, &array[i]);
+                        }
+                    }
+                } catch (...){
+                    std::memmove(static_cast<void *>(array + kept), static_cast<const void *>(array + i),
+                                 (_size - i) * sizeof(T));
+                    _size = kept + (_size - i);
+                    throw;
+                }
+                size_type removed = _size - kept;
+                _size = kept;
+                return removed;
+            }
+        }
+        try {
+            for (; i < _size; i++){
+                if (pred(array[i])){
+                    if (kept != i){
+                        array[kept] = std::move(array[i]);
+                    }
+                    kept++;
+                }
+            }
+        } catch (...){
+            // Непроверенные элементы сдвигаются к оставленным, перемещённые хвостовые удаляются
+            erase(begin() + kept, begin() + i);
+            throw;
+        }
+        size_type removed = _size - kept;
+        erase_till_end(begin() + kept);
+        return removed;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::erase_till_end(iterator pos) noexcept{
+        size_type num = end() - pos;
+        if (num){
+            for (iterator it = pos; it != end(); ++it){
+                alloc_traits::destroy(alloc, &*it);
+            }
+            _size -= num;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    requires std::constructible_from<T, std::iter_reference_t<It>>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry>::vector(It first, S last, const Allocator &allocator): alloc{allocator}{
+        try {
+            insert(end(), std::move(first), std::move(last));
+        } catch (...){
+            clear();
+            deallocate();
+            throw;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+    constexpr vector<T, Allocator, GrowthPolicy, Telemetry>::vector(from_range_t, R &&range, const Allocator &allocator): alloc{allocator}{
+        try {
+            append_range(std::forward<R>(range));
+        } catch (...){
+            clear();
+            deallocate();
+            throw;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    requires std::constructible_from<T, std::iter_reference_t<It>>
+    constexpr iterator<T> vector<T, Allocator, GrowthPolicy, Telemetry>::insert(iterator pos, It first, S last){
+        size_type index = pos - begin();
+        if constexpr (std::forward_iterator<It> || std::sized_sentinel_for<S, It>){
+            size_type n = std::ranges::distance(first, last);
+            insert_with(index, n, [&](T *dest){ construct_n(dest, std::move(first), n); });
+        } else {
+            insert_input(index, std::move(first), std::move(last));
+        }
+        return begin() + index;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr iterator<T> vector<T, Allocator, GrowthPolicy, Telemetry>::insert(iterator pos, const T &value)
+    requires std::copy_constructible<T>{
+        if (contains(std::addressof(value)) && _size < _capacity && pos != end()){
+            // Сдвиг хвоста переместил бы сам value
+            return emplace(pos, value);
+        }
+        size_type index = pos - begin();
+        insert_with(index, 1, [&](T *dest){ alloc_traits::construct(alloc, dest, value); });
+        return begin() + index;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr iterator<T> vector<T, Allocator, GrowthPolicy, Telemetry>::insert(iterator pos, T &&value)
+    requires std::move_constructible<T>{
+        size_type index = pos - begin();
+        insert_with(index, 1, [&](T *dest){ alloc_traits::construct(alloc, dest, std::move(value)); });
+        return begin() + index;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <typename ...Args>
+    requires std::constructible_from<T, Args...> && std::move_constructible<T>
+    constexpr iterator<T> vector<T, Allocator, GrowthPolicy, Telemetry>::emplace(iterator pos, Args &&... args){
+        size_type index = pos - begin();
+        if (_size == _capacity){
+            // Новый блок: элемент конструируется в нём до переноса, аргументы остаются действительными
+            insert_with(index, 1, [&](T *dest){ alloc_traits::construct(alloc, dest, std::forward<Args>(args)...); });
+        } else if (index == _size){
+            alloc_traits::construct(alloc, &array[_size], std::forward<Args>(args)...);
+            _size++;
+        } else {
+            // Аргументы могут ссылаться на элементы хвоста, который будет сдвинут
+            T temp(std::forward<Args>(args)...);
+            insert_with(index, 1, [&](T *dest){ alloc_traits::construct(alloc, dest, std::move(temp)); });
+        }
+        return begin() + index;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr iterator<T> vector<T, Allocator, GrowthPolicy, Telemetry>::insert(iterator pos, size_type n, const T &value)
+    requires std::copy_constructible<T>{
+        size_type index = pos - begin();
+        if (n == 0){
+            return pos;
+        }
+        // value может быть элементом вектора, который сдвинется или будет перенесён
+        T copy(value);
+        insert_with(index, n, [&](T *dest){
+            size_type i = 0;
+            try {
+                for (; i < n; i++){
+                    alloc_traits::construct(alloc, &dest[i], copy);
+                }
+            } catch (...){
+                for (size_type j = 0; j < i; j++){
+                    alloc_traits::destroy(alloc, &dest[j]);
+                }
+                throw;
+            }
+        });
+        return begin() + index;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+    constexpr iterator<T> vector<T, Allocator, GrowthPolicy, Telemetry>::insert_range(iterator pos, R &&range){
+        size_type index = pos - begin();
+        if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>){
+            size_type n = std::ranges::distance(range);
+            insert_with(index, n, [&](T *dest){ construct_n(dest, std::ranges::begin(range), n); });
+        } else {
+            insert_input(index, std::ranges::begin(range), std::ranges::end(range));
+        }
+        return begin() + index;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::append_range(R &&range){
+        insert_range(end(), std::forward<R>(range));
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <std::ranges::input_range R>
+    requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::assign_range(R &&range){
+        if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>){
+            assign_n(std::ranges::begin(range), static_cast<size_type>(std::ranges::distance(range)));
+        } else {
+            assign(std::ranges::begin(range), std::ranges::end(range));
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <typename It>
+    constexpr It vector<T, Allocator, GrowthPolicy, Telemetry>::construct_n(T *dest, It first, size_type n){
+        if constexpr (std::is_trivially_copyable_v<T> && !std::uses_allocator_v<T, Allocator> &&
+                      std::contiguous_iterator<It> && std::is_same_v<std::iter_value_t<It>, T>){
+            if (!std::is_constant_evaluated()){
+                if (n){
+                    std::memcpy(static_cast<void *>(dest), static_cast<const void *>(std::to_address(first)),
+                                n * sizeof(T));
+                }
+                return first + n;
+            }
+        }
+        size_type i = 0;
+        try {
+            for (; i < n; ++i, ++first){
+                alloc_traits::construct(alloc, &dest[i], *first);
+            }
+        } catch (...){
+            for (size_type j = 0; j < i; j++){
+                alloc_traits::destroy(alloc, &dest[j]);
+            }
+            throw;
+        }
+        return first;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <typename Construct>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::insert_with(size_type index, size_type n, Construct &&construct){
+        if (n == 0){
+            return;
+        }
+        size_type tail = _size - index;
+
+        if (_size + n <= _capacity){
+            T *gap = array + index;
+            if constexpr (relocatable){
+                if (!std::is_constant_evaluated()){
+                    std::memmove(static_cast<void *>(gap + n), static_cast<const void *>(gap), tail * sizeof(T));
+                    try {
+                        construct(gap);
+                    } catch (...){
+                        std::memmove(static_cast<void *>(gap), static_cast<const void *>(gap + n), tail * sizeof(T));
+                        throw;
+                    }
+                    _size += n;
+                    return;
+                }
+            }
+            if constexpr (std::is_nothrow_move_constructible_v<T>){
+                // Хвост переносится с конца, поэтому каждая целевая ячейка к моменту записи уже свободна
+                for (size_type i = tail; i > 0; i--){
+                    alloc_traits::construct(alloc, &gap[i - 1 + n], std::move(gap[i - 1]));
+                    alloc_traits::destroy(alloc, &gap[i - 1]);
+                }
+                try {
+                    construct(gap);
+                } catch (...){
+                    for (size_type i = 0; i < tail; i++){
+                        alloc_traits::construct(alloc, &gap[i], std::move(gap[i + n]));
+                        alloc_traits::destroy(alloc, &gap[i + n]);
+                    }
+                    throw;
+                }
+                _size += n;
+                return;
+            } else if constexpr (std::is_move_assignable_v<T> && std::is_swappable_v<T>){
+                // Перемещение может бросить исключение: новые элементы конструируются в свободной памяти за концом
+                // и поворотом встают на место. Исключение при повороте оставляет все элементы живыми,
+                // но их порядок не определён
+                construct(array + _size);
+                _size += n;
+                std::rotate(gap, array + _size - n, array + _size);
+                return;
+            }
+        }
+
+        // Новые элементы конструируются в новом блоке до переноса старых, затем вокруг них переносятся
+        // префикс и суффикс. Ёмкость сохраняется только для типов, которые нельзя сдвинуть на месте
+        size_type newCap = _size + n <= _capacity ? _capacity
+                                                  : GrowthPolicy::next_capacity(_capacity, _size + n, sizeof(T));
+        T *buffer = allocate_block(newCap);
+        try {
+            construct(buffer + index);
+        } catch (...){
+            release_block(buffer, newCap);
+            throw;
+        }
+        if constexpr (relocatable || std::is_nothrow_move_constructible_v<T>){
+            relocate(array, index, buffer);
+            relocate(array + index, tail, buffer + index + n);
+        } else {
+            // Префикс и суффикс копируются до разрушения старых элементов: исключение оставляет вектор нетронутым
+            size_type built = 0;
+            try {
+                for (; built < _size; built++){
+                    alloc_traits::construct(alloc, &buffer[built < index ? built : built + n],
+                                            std::move_if_noexcept(array[built]));
+                }
+            } catch (...){
+                for (size_type i = 0; i < built; i++){
+                    alloc_traits::destroy(alloc, &buffer[i < index ? i : i + n]);
+                }
+                for (size_type i = 0; i < n; i++){
+                    alloc_traits::destroy(alloc, &buffer[index + i]);
+                }
+                release_block(buffer, newCap);
+                throw;
+            }
+            Telemetry::on_relocate(_size, _size * sizeof(T));
+            for (size_type i = 0; i < _size; i++){
+                alloc_traits::destroy(alloc, &array[i]);
+            }
+        }
+        if (array){
+            Telemetry::on_reallocate(_capacity, newCap);
+        }
+        size_type temp = _size;
+        _size = 0;
+        deallocate();
+        array = buffer;
+        _capacity = newCap;
+        _size = temp + n;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <typename It, typename S>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::insert_input(size_type index, It first, S last){
+        size_type oldSize = _size;
+        for (; first != last; ++first){
+            emplace_back(*first);
+        }
+        if (index != oldSize){
+            std::rotate(begin() + index, begin() + oldSize, end());
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    vector<T, Allocator, GrowthPolicy, Telemetry>::vector(const parallel_policy &policy, size_type size, const Allocator &allocator)
+    requires std::default_initializable<T>: alloc{allocator}{
+        reserve(size);
+        try {
+            parallel_construct(policy, size, [this](size_type from, size_type to){
+                // Нулевые байты - значение T() только для чисел и указателей
+                if constexpr ((std::is_arithmetic_v<T> || std::is_pointer_v<T>) && !std::uses_allocator_v<T, Allocator>){
+                    std::memset(static_cast<void *>(array + from), 0, (to - from) * sizeof(T));
+                } else {
+                    construct_each(from, to, [this](T *slot){ alloc_traits::construct(alloc, slot); });
+                }
+            });
+        } catch (...){
+            deallocate();
+            throw;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    vector<T, Allocator, GrowthPolicy, Telemetry>::vector(const parallel_policy &policy, size_type size, const T &el,
+                                               const Allocator &allocator)
+    requires std::copy_constructible<T>: alloc{allocator}{
+        reserve(size);
+        try {
+            parallel_construct(policy, size, [this, &el](size_type from, size_type to){
+                construct_each(from, to, [this, &el](T *slot){ alloc_traits::construct(alloc, slot, el); });
+            });
+        } catch (...){
+            deallocate();
+            throw;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    vector<T, Allocator, GrowthPolicy, Telemetry>::vector(const parallel_policy &policy, const vector &second)
+    requires std::copy_constructible<T>: alloc{alloc_traits::select_on_container_copy_construction(second.alloc)}{
+        reserve(second._size);
+        const T *source = second.array;
+        try {
+            parallel_construct(policy, second._size, [this, source](size_type from, size_type to){
+                construct_n(array + from, source + from, to - from);
+            });
+        } catch (...){
+            deallocate();
+            throw;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    void vector<T, Allocator, GrowthPolicy, Telemetry>::assign(const parallel_policy &policy, const vector &second)
+    requires std::copy_constructible<T>{
+        if (this == &second){
+            return;
+        }
+        clear();
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value){
+            if (alloc != second.alloc){
+                deallocate();
+            }
+            alloc = second.alloc;
+        }
+        if (second._size > _capacity){
+            deallocate();
+            reserve(second._size);
+        }
+        const T *source = second.array;
+        parallel_construct(policy, second._size, [this, source](size_type from, size_type to){
+            construct_n(array + from, source + from, to - from);
+        });
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <typename Construct>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::construct_each(size_type from, size_type to, Construct &&construct){
+        size_type i = from;
+        try {
+            for (; i < to; i++){
+                construct(array + i);
+            }
+        } catch (...){
+            for (size_type j = from; j < i; j++){
+                alloc_traits::destroy(alloc, &array[j]);
+            }
+            throw;
+        }
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    template <typename Chunk>
+    void vector<T, Allocator, GrowthPolicy, Telemetry>::parallel_construct(const parallel_policy &policy, size_type n,
+                                                                Chunk &&chunk){
+        // Ожидается пустой вектор с ёмкостью не меньше n. chunk(from, to) конструирует элементы [from, to)
+        // и при исключении разрушает уже созданные из них
+        size_type threads = policy.threads ? policy.threads : std::max(1u, std::thread::hardware_concurrency());
+        threads = std::min(threads, n / std::max(policy.grain, size_type{1}));
+        if (threads <= 1){
+            chunk(0, n);
+            _size = n;
+            return;
+        }
+
+        // Границы кусков выравниваются по страницам, чтобы каждая страница касалась только одним потоком
+        constexpr size_type page = 4096;
+        size_type align = std::max(size_type{1}, page / sizeof(T));
+        size_type step = ((n + threads - 1) / threads + align - 1) / align * align;
+        threads = (n + step - 1) / step;
+
+        vector<std::exception_ptr> errors(threads);
+        vector<std::thread> workers{};
+        workers.reserve(threads - 1);
+        auto work = [&](size_type t){
+            try {
+                chunk(t * step, std::min(n, (t + 1) * step));
+            } catch (...){
+                errors[t] = std::current_exception();
+            }
+        };
+        for (size_type t = 1; t < threads; t++){
+            try {
+                workers.emplace_back(work, t);
+            } catch (...){
+                // Поток не создан: кусок конструируется в текущем потоке
+                work(t);
+            }
+        }
+        work(0);
+        for (std::thread &worker: workers){
+            worker.join();
+        }
+
+        std::exception_ptr error = nullptr;
+        for (size_type t = 0; t < threads; t++){
+            if (errors[t] && !error){
+                error = errors[t];
+            }
+        }
+        if (error){
+            for (size_type t = 0; t < threads; t++){
+                if (!errors[t]){
+                    for (size_type i = t * step; i < std::min(n, (t + 1) * step); i++){
+                        alloc_traits::destroy(alloc, &array[i]);
+                    }
+                }
+            }
+            std::rethrow_exception(error);
+        }
+        _size = n;
+    }
+
+    template <typename T, typename Allocator, growth_policy GrowthPolicy, telemetry_policy Telemetry>
+    constexpr void vector<T, Allocator, GrowthPolicy, Telemetry>::swap(vector &second) noexcept{
+        if constexpr (alloc_traits::propagate_on_container_swap::value){
+            std::swap(alloc, second.alloc);
+        }
+        std::swap(array, second.array);
+        std::swap(_size, second._size);
+        std::swap(_capacity, second._capacity);
+    }
+}
+
+#endif